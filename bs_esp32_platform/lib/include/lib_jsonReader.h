@@ -0,0 +1,267 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file lib_jsonReader.h
+ * \brief Json reader library header file.
+ *
+ * The JSON reader library walks a JSON string in place. Values are returned
+ * as spans (pointer + length) into the original string, so arrays and
+ * objects of any length are handled without copying them into fixed
+ * buffers like @ref jsonArray_st. Values can be looked up by a path such as
+ * "execution.jobDocument.files[2].url". Binding tables fill the members of
+ * an object straight into the typed fields of a C structure.
+ *
+ * The reader keeps no module state, everything lives in the caller supplied
+ * parser, iterator and span objects. Unlike lib_json it needs no lock and
+ * documents can be parsed from several tasks on both cores at once.
+ *
+ * The libraries have been tested on the ESP32 modules.
+ * Buildstorm explicitly denies responsibility for any hardware failures
+ * arising from the use of these libraries, whether directly or indirectly.
+ *
+ * EULA LICENSE:
+ * This library is licensed under end user license EULA agreement.
+ * The EULA is available at https://buildstorm.com/eula/
+ * For any support contact us at hello@buildstorm.com
+ *
+ */
+
+#ifndef _LIB_JSON_READER_H_
+#define _LIB_JSON_READER_H_
+
+#include <stddef.h>
+
+#include "lib_utils.h"
+
+#define JSON_READER_MAX_DEPTH 32 // one bit per nesting level while skipping containers
+
+/* TRUE scans strings and containers 4 bytes at a time. Experimental: it is slower
+   than the byte loop on host shadow deltas and has not been measured on the ESP32,
+   keep it off until target numbers show a gain. */
+#ifndef JSON_READER_WORD_SCAN
+#define JSON_READER_WORD_SCAN FALSE
+#endif
+
+/**
+ * @enum jsonType_et
+ * An enum that represents the type of a JSON value.
+ */
+typedef enum
+{
+    JSON_TYPE_INVALID, /*!< Not a valid JSON value */
+    JSON_TYPE_OBJECT,  /*!< Object, span includes the braces */
+    JSON_TYPE_ARRAY,   /*!< Array, span includes the brackets */
+    JSON_TYPE_STRING,  /*!< String, span excludes the quotes, escapes are not decoded */
+    JSON_TYPE_NUMBER,  /*!< Number */
+    JSON_TYPE_BOOL,    /*!< true or false */
+    JSON_TYPE_NULL,    /*!< null */
+    JSON_TYPE_MAX      /*!< Total number of JSON types */
+} jsonType_et;
+
+/**
+ * @brief A JSON value located inside the original string.
+ */
+typedef struct
+{
+    const char *pStr;   /*!< Start of the value inside the JSON string */
+    uint16_t len_u16;   /*!< Length of the value */
+    jsonType_et type_e; /*!< Type of the value */
+} jsonSpan_st;
+
+/**
+ * @brief Iterator over the elements of an array or the members of an object.
+ */
+typedef struct
+{
+    const char *pNextStr; /*!< Parse position of the next element */
+    uint32_t index_u32;   /*!< Number of elements returned so far, for reporting only */
+    bool isObject_b8;     /*!< Iterating an object */
+    bool hasElement_b8;   /*!< An element was returned, the next one needs a comma */
+    bool error_b8;        /*!< Iteration stopped on malformed JSON */
+} jsonIter_st;
+
+/**
+ * @enum jsonBindType_et
+ * An enum that represents the C type of a bound structure field.
+ */
+typedef enum
+{
+    JSON_BIND_TYPE_STRING, /*!< char array, escapes decoded, must fit with the NUL */
+    JSON_BIND_TYPE_U8,     /*!< uint8_t */
+    JSON_BIND_TYPE_U16,    /*!< uint16_t */
+    JSON_BIND_TYPE_U32,    /*!< uint32_t */
+    JSON_BIND_TYPE_I32,    /*!< int32_t */
+    JSON_BIND_TYPE_FLOAT,  /*!< float, finite and in range */
+    JSON_BIND_TYPE_BOOL,   /*!< bool */
+    JSON_BIND_TYPE_MAX     /*!< Total number of bind types */
+} jsonBindType_et;
+
+/**
+ * @brief Binds an object member to a field of a C structure.
+ * Use @ref JSON_BIND to fill the offset and size of the field.
+ */
+typedef struct
+{
+    const char *keyStr;     /*!< Key of the object member */
+    jsonBindType_et type_e; /*!< Type of the field */
+    uint16_t offset_u16;    /*!< Offset of the field within the structure */
+    uint16_t size_u16;      /*!< Size of the field */
+} jsonBinding_st;
+
+/**
+ * @brief Key and value buffer for @ref JSON_parserTags, the reentrant
+ * counterpart of @ref tagStructure_st with the size of the value buffer.
+ */
+typedef struct
+{
+    const char *keyStr; /*!< Key of the object member */
+    char *pValueStr;    /*!< Value buffer */
+    uint16_t size_u16;  /*!< Size of value buffer including the NUL */
+} jsonTag_st;
+
+/**
+ * @brief JSON parser context. Initialize it with @ref JSON_parserInit,
+ * one context per task, the members are maintained by the library.
+ */
+typedef struct
+{
+    const char *pJsonStr;   /*!< The JSON string being parsed */
+    uint32_t foundMask_u32; /*!< Bit per tag extracted by the last @ref JSON_parserTags */
+    uint32_t failMask_u32;  /*!< Bit per tag whose value did not fit or had an invalid escape in the last @ref JSON_parserTags */
+    bool error_b8;          /*!< Sticky, set once the JSON is found malformed */
+} jsonParser_st;
+
+#define JSON_BIND_MAX 32 // one bit per binding in the found mask
+
+#define JSON_BIND(structType, key, type, field) \
+    {key, type, (uint16_t)offsetof(structType, field), (uint16_t)sizeof(((structType *)0)->field)}
+
+/**
+ * @brief Find a value by path. Keys are separated by '.', array elements
+ * are selected with [index], e.g. "execution.jobDocument.files[2].url".
+ * An empty or NULL path selects the root value. The lookup is lazy, only
+ * the JSON up to the end of the value is checked: containers on the path are
+ * not scanned past the matched member, so a document that is truncated or
+ * malformed after the value still resolves.
+ * @param [in] pJsonStr The JSON string
+ * @param [in] pPathStr Path of the value
+ * @param [out] ps_value Span of the value
+ * @returns Status of the lookup
+ * @retval true when the value is found
+ * @retval false when not found, the path is invalid or the JSON before the end of the value is malformed
+ */
+bool JSON_getPath(const char *pJsonStr, const char *pPathStr, jsonSpan_st *ps_value);
+
+/**
+ * @brief Start iterating the array found at the given path. The lookup is lazy
+ * like @ref JSON_getPath, malformed JSON is reported by the iteration.
+ * @param [out] ps_iter Iterator
+ * @param [in] pJsonStr The JSON string, an element span of an outer iteration can be passed as well
+ * @param [in] pPathStr Path of the array, NULL for the root value
+ * @returns Status
+ * @retval true when the array is found
+ * @retval false when not found or not an array
+ */
+bool JSON_arrayBegin(jsonIter_st *ps_iter, const char *pJsonStr, const char *pPathStr);
+
+/**
+ * @brief Get the next array element.
+ * @param [inout] ps_iter Iterator
+ * @param [out] ps_value Span of the element
+ * @returns Status
+ * @retval true when an element is returned
+ * @retval false at the end of the array, ps_iter->error_b8 is set if the JSON was malformed
+ */
+bool JSON_arrayNext(jsonIter_st *ps_iter, jsonSpan_st *ps_value);
+
+/**
+ * @brief Start iterating the object found at the given path. The lookup is lazy
+ * like @ref JSON_getPath, malformed JSON is reported by the iteration.
+ * @param [out] ps_iter Iterator
+ * @param [in] pJsonStr The JSON string
+ * @param [in] pPathStr Path of the object, NULL for the root value
+ * @returns Status
+ * @retval true when the object is found
+ * @retval false when not found or not an object
+ */
+bool JSON_objectBegin(jsonIter_st *ps_iter, const char *pJsonStr, const char *pPathStr);
+
+/**
+ * @brief Get the next object member.
+ * @param [inout] ps_iter Iterator
+ * @param [out] ps_key Span of the key (type string)
+ * @param [out] ps_value Span of the value
+ * @returns Status
+ * @retval true when a member is returned
+ * @retval false at the end of the object, ps_iter->error_b8 is set if the JSON was malformed
+ */
+bool JSON_objectNext(jsonIter_st *ps_iter, jsonSpan_st *ps_key, jsonSpan_st *ps_value);
+
+/**
+ * @brief Copy a span into a NUL terminated buffer. String escapes are decoded,
+ * \\u0000 and unpaired surrogates are rejected.
+ * @param [in] ps_span Span to copy
+ * @param [out] pBuffStr Destination buffer
+ * @param [in] size_u16 Size of destination buffer
+ * @returns Copy status
+ * @retval true on success
+ * @retval false when the value does not fit or has an invalid escape, the buffer is left empty
+ */
+bool JSON_spanCopy(const jsonSpan_st *ps_span, char *pBuffStr, uint16_t size_u16);
+
+/**
+ * @brief Fill a structure from the members of the object found at the given path,
+ * in one pass over the object. Numbers are accepted as JSON numbers or as numeric strings.
+ * Fields of members that are not present are left untouched.
+ * @param [in] pJsonStr The JSON string
+ * @param [in] pPathStr Path of the object, NULL for the root value
+ * @param [in] as_bindings Binding table
+ * @param [in] maxBindings_u8 Number of bindings (max JSON_BIND_MAX)
+ * @param [out] pStruct Structure to be filled
+ * @param [out] pFoundMask_u32 Bit per binding set when the field was filled, can be NULL
+ * @returns Status of binding
+ * @retval true when every member present was bound
+ * @retval false on malformed JSON, a value that does not fit its field (string overflow,
+ * integer out of range, float overflow or underflow) or of the wrong type, the field is left zeroed
+ */
+bool JSON_bind(const char *pJsonStr, const char *pPathStr, const jsonBinding_st as_bindings[], uint8_t maxBindings_u8, void *pStruct, uint32_t *pFoundMask_u32);
+
+/**
+ * @brief Initialize a parser context on a JSON string.
+ * The string must stay valid while the context is used.
+ * @param [out] ps_parser Parser context
+ * @param [in] pJsonStr The JSON string
+ * @returns none
+ */
+void JSON_parserInit(jsonParser_st *ps_parser, const char *pJsonStr);
+
+/**
+ * @brief Find a value by path in the parser document, see @ref JSON_getPath.
+ * @param [inout] ps_parser Parser context
+ * @param [in] pPathStr Path of the value
+ * @param [out] ps_value Span of the value
+ * @returns Status of the lookup
+ * @retval true when the value is found
+ * @retval false when not found, the JSON before the end of the value is malformed
+ * (error_b8 is latched) or an earlier call found the document malformed
+ */
+bool JSON_parserGetPath(jsonParser_st *ps_parser, const char *pPathStr, jsonSpan_st *ps_value);
+
+/**
+ * @brief Extract the key-value pairs specified by tags from the object found at
+ * the given path, in one pass over the object. Reentrant replacement for
+ * @ref JSON_processString. Strings are copied with the escapes decoded, other
+ * values are copied as they appear in the JSON. Values of absent keys, and of keys
+ * whose value does not fit its buffer (reported in failMask_u32), are left empty.
+ * @param [inout] ps_parser Parser context, foundMask_u32 and failMask_u32 are updated
+ * @param [in] pPathStr Path of the object, NULL for the root value
+ * @param [in] as_tags An array of key-value pairs to be extracted
+ * @param [in] maxTags_u8 Number of tags (max JSON_BIND_MAX)
+ * @returns Number of tags extracted
+ * @retval 0 when none was found, the object was not found or error_b8 was already set
+ * On malformed JSON, also on the way to the object, error_b8 is latched and the tags
+ * extracted before the error are counted.
+ */
+uint8_t JSON_parserTags(jsonParser_st *ps_parser, const char *pPathStr, const jsonTag_st as_tags[], uint8_t maxTags_u8);
+
+#endif //_LIB_JSON_READER_H_
@@ -0,0 +1,156 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file lib_jsonWriter.h
+ * \brief Json writer library header file.
+ *
+ * The JSON writer library builds JSON documents directly into a caller
+ * supplied buffer (for example @ref mqttMsg_st payloadStr) without heap
+ * allocations or printf style formatting. Every write is bounds checked,
+ * once the buffer runs out of space the writer stops and reports failure.
+ *
+ * The libraries have been tested on the ESP32 modules.
+ * Buildstorm explicitly denies responsibility for any hardware failures
+ * arising from the use of these libraries, whether directly or indirectly.
+ *
+ * EULA LICENSE:
+ * This library is licensed under end user license EULA agreement.
+ * The EULA is available at https://buildstorm.com/eula/
+ * For any support contact us at hello@buildstorm.com
+ *
+ */
+
+#ifndef _LIB_JSON_WRITER_H_
+#define _LIB_JSON_WRITER_H_
+
+#include "lib_utils.h"
+
+#define JSON_WRITER_MAX_DEPTH 16 // one bit per nesting level in the writer masks
+#define JSON_WRITER_MAX_DEC_POINTS 6 // max digits after the decimal point for floats
+
+/**
+ * @brief JSON writer context. Initialize it with @ref JSON_writerInit,
+ * the members are maintained by the library.
+ */
+typedef struct
+{
+    char *pBuffStr;          /*!< Output buffer, always NUL terminated */
+    uint16_t size_u16;       /*!< Size of output buffer including the NUL */
+    uint16_t len_u16;        /*!< Number of bytes written */
+    uint16_t objectMask_u16; /*!< Bit per depth, set when the container is an object */
+    uint16_t commaMask_u16;  /*!< Bit per depth, set once the container has an element */
+    uint8_t depth_u8;        /*!< Current nesting depth */
+    bool keyPending_b8;      /*!< A key was written, its value is expected next */
+    bool error_b8;           /*!< Buffer overflow or invalid call sequence */
+} jsonWriter_st;
+
+/**
+ * @brief Initialize the JSON writer on a given buffer.
+ * @param [out] ps_writer Writer context
+ * @param [in] pBuffStr Output buffer
+ * @param [in] size_u16 Size of output buffer
+ * @returns none
+ */
+void JSON_writerInit(jsonWriter_st *ps_writer, char *pBuffStr, uint16_t size_u16);
+
+/**
+ * @brief Finish the JSON document.
+ * @param [in] ps_writer Writer context
+ * @returns Length of the JSON document
+ * @retval 0 on overflow, unbalanced containers or a key without value
+ */
+uint16_t JSON_writerEnd(jsonWriter_st *ps_writer);
+
+/**
+ * @brief Open/Close a JSON object '{' '}'.
+ * @param [in] ps_writer Writer context
+ * @returns Write status
+ * @retval true on success
+ * @retval false on overflow or invalid call sequence
+ */
+bool JSON_writeObjectStart(jsonWriter_st *ps_writer);
+bool JSON_writeObjectEnd(jsonWriter_st *ps_writer);
+
+/**
+ * @brief Open/Close a JSON array '[' ']'.
+ * @param [in] ps_writer Writer context
+ * @returns Write status
+ * @retval true on success
+ * @retval false on overflow or invalid call sequence
+ */
+bool JSON_writeArrayStart(jsonWriter_st *ps_writer);
+bool JSON_writeArrayEnd(jsonWriter_st *ps_writer);
+
+/**
+ * @brief Write a key inside an object, the next call must write its value.
+ * @param [in] ps_writer Writer context
+ * @param [in] pKeyStr Key, escaped by the writer
+ * @returns Write status
+ * @retval true on success
+ * @retval false on overflow, a NULL key or when not inside an object
+ */
+bool JSON_writeKey(jsonWriter_st *ps_writer, const char *pKeyStr);
+
+/**
+ * @brief Write a signed integer value. Inside an object the value follows @ref JSON_writeKey,
+ * inside an array the values are comma separated automatically.
+ * @param [in] ps_writer Writer context
+ * @param [in] value_i32 Value to be written
+ * @returns Write status
+ * @retval true on success
+ * @retval false on overflow or invalid call sequence
+ */
+bool JSON_writeInt(jsonWriter_st *ps_writer, int32_t value_i32);
+
+/**
+ * @brief Write an unsigned integer value, see @ref JSON_writeInt.
+ * @param [in] ps_writer Writer context
+ * @param [in] value_u32 Value to be written
+ * @returns Write status
+ * @retval true on success
+ * @retval false on overflow or invalid call sequence
+ */
+bool JSON_writeUint(jsonWriter_st *ps_writer, uint32_t value_u32);
+
+/**
+ * @brief Write true or false, see @ref JSON_writeInt.
+ * @param [in] ps_writer Writer context
+ * @param [in] value_b8 Value to be written
+ * @returns Write status
+ * @retval true on success
+ * @retval false on overflow or invalid call sequence
+ */
+bool JSON_writeBool(jsonWriter_st *ps_writer, bool value_b8);
+
+/**
+ * @brief Write null, see @ref JSON_writeInt.
+ * @param [in] ps_writer Writer context
+ * @returns Write status
+ * @retval true on success
+ * @retval false on overflow or invalid call sequence
+ */
+bool JSON_writeNull(jsonWriter_st *ps_writer);
+
+/**
+ * @brief Write a string value, escaped by the writer, see @ref JSON_writeInt.
+ * @param [in] ps_writer Writer context
+ * @param [in] pStr String to be written, NULL is written as ""
+ * @returns Write status
+ * @retval true on success
+ * @retval false on overflow or invalid call sequence
+ */
+bool JSON_writeString(jsonWriter_st *ps_writer, const char *pStr);
+
+/**
+ * @brief Write a float value with fixed precision, rounded half away from zero.
+ * NaN, infinity and values too large for fixed point are written as null.
+ * @param [in] ps_writer Writer context
+ * @param [in] value_f32 Value to be written
+ * @param [in] decPoints_u8 Digits after the decimal point (max JSON_WRITER_MAX_DEC_POINTS)
+ * @returns Write status
+ * @retval true on success
+ * @retval false on overflow or invalid call sequence
+ */
+bool JSON_writeFloat(jsonWriter_st *ps_writer, float value_f32, uint8_t decPoints_u8);
+
+#endif //_LIB_JSON_WRITER_H_
@@ -0,0 +1,1105 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file lib_jsonReader.c
+ * \brief Json reader library source file.
+ *
+ * In place JSON reader, see lib_jsonReader.h for the api.
+ *
+ * The libraries have been tested on the ESP32 modules.
+ * Buildstorm explicitly denies responsibility for any hardware failures
+ * arising from the use of these libraries, whether directly or indirectly.
+ *
+ * EULA LICENSE:
+ * This library is licensed under end user license EULA agreement.
+ * The EULA is available at https://buildstorm.com/eula/
+ * For any support contact us at hello@buildstorm.com
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lib_jsonReader.h"
+
+/* Macros ------------------------------------------------------------------*/
+#define LENGTH_SPAN_MAX 0xFFFFu
+#define LENGTH_BIND_NUMBER 32 // longest number text accepted by JSON_bind
+
+/* Word at a time scanning (SWAR): each test flags a word that holds the byte */
+#define JSON_WORD_ONES 0x01010101u
+#define JSON_WORD_HIGHS 0x80808080u
+#define json_wordHasZero(w) ((((w)-JSON_WORD_ONES) & ~(w)) & JSON_WORD_HIGHS)
+#define json_wordHasByte(w, ch) json_wordHasZero((w) ^ (JSON_WORD_ONES * (uint8_t)(ch)))
+
+/* '{' '}' '[' ']' differ only in bits 0x26, the class test may flag a few
+   other bytes ('Y' '_' 'y' DEL) which only costs a byte wise rescan */
+#define json_wordHasBracket(w) json_wordHasByte(((w) | 0x20202020u) & 0xF9F9F9F9u, 0x79)
+
+#define JSON_SCAN_BYTES_FIRST 8 // bytes scanned one by one before switching to words
+
+#define json_isWhiteSpace(ch) (((ch) == ' ') || ((ch) == '\t') || ((ch) == '\n') || ((ch) == '\r'))
+#define json_isStringStop(ch) (((ch) == '"') || ((ch) == '\\') || ((ch) == 0))
+#define json_isStructural(ch) (((ch) == '{') || ((ch) == '}') || ((ch) == '[') || ((ch) == ']') || ((ch) == '"') || ((ch) == 0))
+#define json_isDelimiter(ch) (((ch) == ',') || ((ch) == '}') || ((ch) == ']') || ((ch) == 0) || json_isWhiteSpace(ch))
+
+/* Local Functions ----------------------------------------------------------*/
+
+static const char *json_skipWhiteSpace(const char *pStr)
+{
+    while (json_isWhiteSpace(*pStr))
+    {
+        pStr++;
+    }
+    return pStr;
+}
+
+#if (JSON_READER_WORD_SCAN == TRUE)
+/* The word holding the NUL is read past the end of the string on purpose,
+ * the load and both scan loops using it are excluded from ASan */
+__attribute__((no_sanitize_address)) static uint32_t json_loadWord(const char *pStr)
+{
+    uint32_t word_u32;
+
+    // aligned load, never crosses into the next page even past the NUL
+    memcpy(&word_u32, __builtin_assume_aligned(pStr, sizeof(uint32_t)), sizeof(uint32_t));
+    return word_u32;
+}
+
+/* Advances to the first '"', '\\' or NUL. Short strings (keys, enums) are done
+ * byte wise, the word loop only kicks in for long values like urls and tokens. */
+__attribute__((no_sanitize_address)) static const char *json_scanString(const char *pStr)
+{
+    const char *pWordStart = (const char *)(((uintptr_t)pStr + JSON_SCAN_BYTES_FIRST) & ~(uintptr_t)(sizeof(uint32_t) - 1));
+
+    for (; pStr < pWordStart; pStr++)
+    {
+        if (json_isStringStop(*pStr))
+        {
+            return pStr;
+        }
+    }
+
+    for (;; pStr += sizeof(uint32_t))
+    {
+        uint32_t word_u32 = json_loadWord(pStr);
+
+        if (json_wordHasZero(word_u32) | json_wordHasByte(word_u32, '"') | json_wordHasByte(word_u32, '\\'))
+        {
+            break;
+        }
+    }
+
+    while (!json_isStringStop(*pStr))
+    {
+        pStr++;
+    }
+    return pStr;
+}
+
+/* Advances to the first bracket, '"' or NUL, same scheme as json_scanString */
+__attribute__((no_sanitize_address)) static const char *json_scanStructural(const char *pStr)
+{
+    const char *pWordStart = (const char *)(((uintptr_t)pStr + JSON_SCAN_BYTES_FIRST) & ~(uintptr_t)(sizeof(uint32_t) - 1));
+
+    for (; pStr < pWordStart; pStr++)
+    {
+        if (json_isStructural(*pStr))
+        {
+            return pStr;
+        }
+    }
+
+    for (;; pStr += sizeof(uint32_t))
+    {
+        uint32_t word_u32 = json_loadWord(pStr);
+
+        if (json_wordHasZero(word_u32) | json_wordHasByte(word_u32, '"') | json_wordHasBracket(word_u32))
+        {
+            break;
+        }
+    }
+
+    while (!json_isStructural(*pStr))
+    {
+        pStr++;
+    }
+    return pStr;
+}
+#else
+static const char *json_scanString(const char *pStr)
+{
+    while (!json_isStringStop(*pStr))
+    {
+        pStr++;
+    }
+    return pStr;
+}
+
+static const char *json_scanStructural(const char *pStr)
+{
+    while (!json_isStructural(*pStr))
+    {
+        pStr++;
+    }
+    return pStr;
+}
+#endif
+
+/* pStr points after the opening quote, returns the closing quote or NULL */
+static const char *json_findStringEnd(const char *pStr)
+{
+    for (;;)
+    {
+        pStr = json_scanString(pStr);
+
+        if (*pStr == '"')
+        {
+            return pStr;
+        }
+        if ((*pStr == 0) || (pStr[1] == 0))
+        {
+            return NULL;
+        }
+        pStr += 2; // escaped character
+    }
+}
+
+/* pStr points at '{' or '[', returns the position after the matching bracket or NULL */
+static const char *json_skipContainer(const char *pStr)
+{
+    uint32_t objectMask_u32 = 0; // bit per depth, set for objects
+    uint8_t depth_u8 = 0;
+
+    do
+    {
+        pStr = json_scanStructural(pStr);
+        switch (*pStr)
+        {
+        case '{':
+        case '[':
+            if (depth_u8 >= JSON_READER_MAX_DEPTH)
+            {
+                return NULL;
+            }
+            // unsigned masks, util_GetBitMask would shift a signed int into bit 31
+            if (*pStr == '{')
+            {
+                objectMask_u32 |= (1u << depth_u8);
+            }
+            else
+            {
+                objectMask_u32 &= ~(1u << depth_u8);
+            }
+            depth_u8++;
+            break;
+
+        case '}':
+        case ']':
+            depth_u8--;
+            if ((((objectMask_u32 >> depth_u8) & 1u) != 0) != (*pStr == '}'))
+            {
+                return NULL;
+            }
+            break;
+
+        case '"':
+            pStr = json_findStringEnd(pStr + 1);
+            if (pStr == NULL)
+            {
+                return NULL;
+            }
+            break;
+
+        case 0:
+            return NULL;
+
+        default:
+            break;
+        }
+        pStr++;
+    } while (depth_u8);
+
+    return pStr;
+}
+
+/* Checks the JSON number grammar -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+ * at pStr, returns the position after the number or NULL */
+static const char *json_scanNumber(const char *pStr)
+{
+    if (*pStr == '-')
+    {
+        pStr++;
+    }
+
+    if (*pStr == '0')
+    {
+        pStr++;
+    }
+    else if (util_IsAsciiInt(*pStr))
+    {
+        while (util_IsAsciiInt(*pStr))
+        {
+            pStr++;
+        }
+    }
+    else
+    {
+        return NULL;
+    }
+
+    if (*pStr == '.')
+    {
+        if (!util_IsAsciiInt(pStr[1]))
+        {
+            return NULL;
+        }
+        for (pStr++; util_IsAsciiInt(*pStr); pStr++)
+        {
+        }
+    }
+
+    if ((*pStr == 'e') || (*pStr == 'E'))
+    {
+        pStr++;
+        if ((*pStr == '+') || (*pStr == '-'))
+        {
+            pStr++;
+        }
+        if (!util_IsAsciiInt(*pStr))
+        {
+            return NULL;
+        }
+        while (util_IsAsciiInt(*pStr))
+        {
+            pStr++;
+        }
+    }
+
+    return pStr;
+}
+
+/* Parses one value at pStr, returns the position after it or NULL */
+static const char *json_parseValue(const char *pStr, jsonSpan_st *ps_value)
+{
+    const char *pStart = pStr;
+    const char *pEnd;
+
+    switch (*pStr)
+    {
+    case '{':
+    case '[':
+        ps_value->type_e = (*pStr == '{') ? JSON_TYPE_OBJECT : JSON_TYPE_ARRAY;
+        pEnd = json_skipContainer(pStr);
+        break;
+
+    case '"':
+        ps_value->type_e = JSON_TYPE_STRING;
+        pStart = pStr + 1;
+        pEnd = json_findStringEnd(pStart);
+        break;
+
+    case 't':
+    case 'f':
+    case 'n':
+        ps_value->type_e = (*pStr == 'n') ? JSON_TYPE_NULL : JSON_TYPE_BOOL;
+        pEnd = (strncmp(pStr, "true", 4) == 0)    ? (pStr + 4)
+               : (strncmp(pStr, "false", 5) == 0) ? (pStr + 5)
+               : (strncmp(pStr, "null", 4) == 0)  ? (pStr + 4)
+                                                  : NULL;
+        if ((pEnd != NULL) && !json_isDelimiter(*pEnd))
+        {
+            pEnd = NULL;
+        }
+        break;
+
+    default:
+        ps_value->type_e = JSON_TYPE_NUMBER;
+        pEnd = json_scanNumber(pStr);
+        if ((pEnd != NULL) && !json_isDelimiter(*pEnd))
+        {
+            pEnd = NULL;
+        }
+        break;
+    }
+
+    if ((pEnd == NULL) || ((pEnd - pStart) > LENGTH_SPAN_MAX))
+    {
+        ps_value->type_e = JSON_TYPE_INVALID;
+        return NULL;
+    }
+
+    ps_value->pStr = pStart;
+    ps_value->len_u16 = (uint16_t)(pEnd - pStart);
+
+    // strings end at the quote, step over it
+    return (ps_value->type_e == JSON_TYPE_STRING) ? (pEnd + 1) : pEnd;
+}
+
+static bool json_iterBegin(jsonIter_st *ps_iter, const jsonSpan_st *ps_container, jsonType_et type_e)
+{
+    memset(ps_iter, 0, sizeof(jsonIter_st));
+
+    if (ps_container->type_e != type_e)
+    {
+        ps_iter->error_b8 = true;
+        return false;
+    }
+
+    ps_iter->pNextStr = ps_container->pStr + 1;
+    ps_iter->isObject_b8 = (type_e == JSON_TYPE_OBJECT);
+
+    return true;
+}
+
+/* Steps over the separator and the key of the next element, returns the start of its value */
+static const char *json_iterSeek(jsonIter_st *ps_iter, jsonSpan_st *ps_key)
+{
+    const char *pStr;
+
+    if (ps_iter->error_b8 || (ps_iter->pNextStr == NULL))
+    {
+        return NULL;
+    }
+
+    pStr = json_skipWhiteSpace(ps_iter->pNextStr);
+
+    if (*pStr == (ps_iter->isObject_b8 ? '}' : ']'))
+    {
+        ps_iter->pNextStr = NULL;
+        return NULL;
+    }
+
+    if (ps_iter->hasElement_b8)
+    {
+        if (*pStr != ',')
+        {
+            ps_iter->error_b8 = true;
+            return NULL;
+        }
+        pStr = json_skipWhiteSpace(pStr + 1);
+    }
+
+    if (ps_iter->isObject_b8)
+    {
+        if ((*pStr != '"') || ((pStr = json_parseValue(pStr, ps_key)) == NULL))
+        {
+            ps_iter->error_b8 = true;
+            return NULL;
+        }
+
+        pStr = json_skipWhiteSpace(pStr);
+        if (*pStr != ':')
+        {
+            ps_iter->error_b8 = true;
+            return NULL;
+        }
+        pStr = json_skipWhiteSpace(pStr + 1);
+    }
+
+    return pStr;
+}
+
+/* Parses the value found by json_iterSeek and moves the iterator past it */
+static bool json_iterFinish(jsonIter_st *ps_iter, const char *pStr, jsonSpan_st *ps_value)
+{
+    pStr = json_parseValue(pStr, ps_value);
+    if (pStr == NULL)
+    {
+        ps_iter->error_b8 = true;
+        return false;
+    }
+
+    ps_iter->pNextStr = pStr;
+    ps_iter->index_u32++;
+    ps_iter->hasElement_b8 = true;
+
+    return true;
+}
+
+static bool json_iterNext(jsonIter_st *ps_iter, jsonSpan_st *ps_key, jsonSpan_st *ps_value)
+{
+    const char *pStr = json_iterSeek(ps_iter, ps_key);
+
+    return (pStr != NULL) && json_iterFinish(ps_iter, pStr, ps_value);
+}
+
+/* Resolves only the start and type of a container, its end is not scanned */
+static bool json_enterContainer(const char *pStr, jsonSpan_st *ps_value)
+{
+    ps_value->pStr = pStr;
+    ps_value->len_u16 = 0;
+    ps_value->type_e = (*pStr == '{')   ? JSON_TYPE_OBJECT
+                       : (*pStr == '[') ? JSON_TYPE_ARRAY
+                                        : JSON_TYPE_INVALID;
+
+    return (ps_value->type_e != JSON_TYPE_INVALID);
+}
+
+static bool json_spanEquals(const jsonSpan_st *ps_span, const char *pStr, uint16_t len_u16)
+{
+    return (ps_span->len_u16 == len_u16) && (memcmp(ps_span->pStr, pStr, len_u16) == 0);
+}
+
+static int32_t json_getHex16(const char *pStr)
+{
+    int32_t value_i32 = 0;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        char ch = util_toUpper(pStr[i]);
+
+        if (!util_IsAsciiHex(ch))
+        {
+            return -1;
+        }
+        value_i32 = (value_i32 << 4) | util_Ascii2Hex(ch);
+    }
+    return value_i32;
+}
+
+/* Decodes an escape sequence at pStr ('\' excluded), returns bytes written to pOut or 0 */
+static uint8_t json_decodeEscape(const char *pStr, const char *pEnd, char *pOut, uint8_t *pConsumed_u8)
+{
+    int32_t code_i32;
+    uint32_t code_u32;
+
+    *pConsumed_u8 = 1;
+    switch (*pStr)
+    {
+    case '"':
+    case '\\':
+    case '/':
+        *pOut = *pStr;
+        return 1;
+    case 'b':
+        *pOut = '\b';
+        return 1;
+    case 'f':
+        *pOut = '\f';
+        return 1;
+    case 'n':
+        *pOut = '\n';
+        return 1;
+    case 'r':
+        *pOut = '\r';
+        return 1;
+    case 't':
+        *pOut = '\t';
+        return 1;
+    case 'u':
+        break;
+    default:
+        return 0;
+    }
+
+    if ((pEnd - pStr) < 5)
+    {
+        return 0;
+    }
+    code_i32 = json_getHex16(pStr + 1);
+    if (code_i32 < 0)
+    {
+        return 0;
+    }
+    code_u32 = (uint32_t)code_i32;
+    *pConsumed_u8 = 5;
+
+    // NUL would truncate the copied string, a lone low surrogate is not a character
+    if ((code_u32 == 0) || ((code_u32 >= 0xDC00) && (code_u32 <= 0xDFFF)))
+    {
+        return 0;
+    }
+
+    // surrogate pair, e.g. "\\ud83d\\ude00", a high surrogate needs its low half
+    if ((code_u32 >= 0xD800) && (code_u32 <= 0xDBFF))
+    {
+        int32_t low_i32 = -1;
+
+        if (((pEnd - pStr) >= 11) && (pStr[5] == '\\') && (pStr[6] == 'u'))
+        {
+            low_i32 = json_getHex16(pStr + 7);
+        }
+        if ((low_i32 < 0xDC00) || (low_i32 > 0xDFFF))
+        {
+            return 0;
+        }
+        code_u32 = 0x10000 + ((code_u32 - 0xD800) << 10) + ((uint32_t)low_i32 - 0xDC00);
+        *pConsumed_u8 = 11;
+    }
+
+    if (code_u32 < 0x80)
+    {
+        pOut[0] = (char)code_u32;
+        return 1;
+    }
+    if (code_u32 < 0x800)
+    {
+        pOut[0] = (char)(0xC0 | (code_u32 >> 6));
+        pOut[1] = (char)(0x80 | (code_u32 & 0x3F));
+        return 2;
+    }
+    if (code_u32 < 0x10000)
+    {
+        pOut[0] = (char)(0xE0 | (code_u32 >> 12));
+        pOut[1] = (char)(0x80 | ((code_u32 >> 6) & 0x3F));
+        pOut[2] = (char)(0x80 | (code_u32 & 0x3F));
+        return 3;
+    }
+    pOut[0] = (char)(0xF0 | (code_u32 >> 18));
+    pOut[1] = (char)(0x80 | ((code_u32 >> 12) & 0x3F));
+    pOut[2] = (char)(0x80 | ((code_u32 >> 6) & 0x3F));
+    pOut[3] = (char)(0x80 | (code_u32 & 0x3F));
+    return 4;
+}
+
+/* Parses an integer span (number or numeric string), no fraction or exponent allowed */
+static bool json_spanToInt(const jsonSpan_st *ps_span, bool *pNegative_b8, uint32_t *pValue_u32)
+{
+    const char *pStr = ps_span->pStr;
+    const char *pEnd = ps_span->pStr + ps_span->len_u16;
+    uint32_t value_u32 = 0;
+
+    *pNegative_b8 = (pStr < pEnd) && (*pStr == '-');
+    if (*pNegative_b8)
+    {
+        pStr++;
+    }
+
+    if (pStr == pEnd)
+    {
+        return false;
+    }
+
+    for (; pStr < pEnd; pStr++)
+    {
+        uint8_t digit_u8;
+
+        if (!util_IsAsciiInt(*pStr))
+        {
+            return false;
+        }
+
+        digit_u8 = util_Ascii2Dec(*pStr);
+        if (value_u32 > ((UINT32_MAX - digit_u8) / 10))
+        {
+            return false;
+        }
+        value_u32 = (value_u32 * 10) + digit_u8;
+    }
+
+    *pValue_u32 = value_u32;
+    return true;
+}
+
+static bool json_bindValue(const jsonBinding_st *ps_binding, const jsonSpan_st *ps_value, uint8_t *pField_u8)
+{
+    bool negative_b8;
+    uint32_t value_u32;
+    uint8_t fieldSize_u8;
+
+    if ((ps_value->type_e != JSON_TYPE_NUMBER) && (ps_value->type_e != JSON_TYPE_STRING) &&
+        !((ps_binding->type_e == JSON_BIND_TYPE_BOOL) && (ps_value->type_e == JSON_TYPE_BOOL)))
+    {
+        return false;
+    }
+
+    switch (ps_binding->type_e)
+    {
+    case JSON_BIND_TYPE_STRING:
+        return (ps_value->type_e == JSON_TYPE_STRING) && JSON_spanCopy(ps_value, (char *)pField_u8, ps_binding->size_u16);
+
+    case JSON_BIND_TYPE_U8:
+    case JSON_BIND_TYPE_U16:
+    case JSON_BIND_TYPE_U32:
+        fieldSize_u8 = (ps_binding->type_e == JSON_BIND_TYPE_U8)    ? sizeof(uint8_t)
+                       : (ps_binding->type_e == JSON_BIND_TYPE_U16) ? sizeof(uint16_t)
+                                                                     : sizeof(uint32_t);
+        if ((ps_binding->size_u16 != fieldSize_u8) ||
+            !json_spanToInt(ps_value, &negative_b8, &value_u32) ||
+            (negative_b8 && value_u32) ||
+            ((fieldSize_u8 < 4) && (value_u32 >> (8 * fieldSize_u8))))
+        {
+            return false;
+        }
+        if (fieldSize_u8 == 1)
+        {
+            *pField_u8 = (uint8_t)value_u32;
+        }
+        else if (fieldSize_u8 == 2)
+        {
+            uint16_t value_u16 = (uint16_t)value_u32;
+            memcpy(pField_u8, &value_u16, sizeof(value_u16));
+        }
+        else
+        {
+            memcpy(pField_u8, &value_u32, sizeof(value_u32));
+        }
+        return true;
+
+    case JSON_BIND_TYPE_I32:
+    {
+        int32_t value_i32;
+
+        if ((ps_binding->size_u16 != sizeof(int32_t)) ||
+            !json_spanToInt(ps_value, &negative_b8, &value_u32) ||
+            (value_u32 > (negative_b8 ? 0x80000000u : 0x7FFFFFFFu)))
+        {
+            return false;
+        }
+        value_i32 = negative_b8 ? (int32_t)(0u - value_u32) : (int32_t)value_u32;
+        memcpy(pField_u8, &value_i32, sizeof(value_i32));
+        return true;
+    }
+
+    case JSON_BIND_TYPE_FLOAT:
+    {
+        char numberStr[LENGTH_BIND_NUMBER];
+        char *pEnd;
+        float value_f32;
+
+        if ((ps_binding->size_u16 != sizeof(float)) ||
+            (ps_value->len_u16 == 0) ||
+            (ps_value->len_u16 >= LENGTH_BIND_NUMBER))
+        {
+            return false;
+        }
+        memcpy(numberStr, ps_value->pStr, ps_value->len_u16);
+        numberStr[ps_value->len_u16] = 0;
+
+        // JSON number grammar first, strtof also takes hex, inf and nan
+        if (json_scanNumber(numberStr) != &numberStr[ps_value->len_u16])
+        {
+            return false;
+        }
+
+        errno = 0;
+        value_f32 = strtof(numberStr, &pEnd);
+        if ((*pEnd != 0) || (errno == ERANGE) || !isfinite(value_f32))
+        {
+            return false;
+        }
+        memcpy(pField_u8, &value_f32, sizeof(value_f32));
+        return true;
+    }
+
+    case JSON_BIND_TYPE_BOOL:
+    {
+        bool value_b8;
+
+        if (ps_binding->size_u16 != sizeof(bool))
+        {
+            return false;
+        }
+        if (ps_value->type_e == JSON_TYPE_BOOL)
+        {
+            value_b8 = (ps_value->pStr[0] == 't');
+        }
+        else if (json_spanToInt(ps_value, &negative_b8, &value_u32) && !negative_b8 && (value_u32 <= 1))
+        {
+            value_b8 = (value_u32 == 1);
+        }
+        else
+        {
+            return false;
+        }
+        memcpy(pField_u8, &value_b8, sizeof(value_b8));
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+/* Enters the container at pStr. A valid value that is not a container is only
+ * not found, pMalformed_b8 is set when the value does not parse either. */
+static bool json_enterPath(const char *pStr, jsonSpan_st *ps_value, bool *pMalformed_b8)
+{
+    jsonSpan_st s_scalar;
+
+    if (json_enterContainer(pStr, ps_value))
+    {
+        return true;
+    }
+
+    *pMalformed_b8 = (json_parseValue(pStr, &s_scalar) == NULL);
+    return false;
+}
+
+/* Walks pPathStr from the root value. Containers on the path are only entered and
+ * scanned up to the matched member, the value at the end of the path is parsed in
+ * full. With needSpan_b8 false a container at the end of the path is only entered
+ * (for iteration), it is not scanned to its end. On failure pMalformed_b8 tells
+ * malformed JSON apart from a path that is not found or invalid. */
+static bool json_locate(const char *pJsonStr, const char *pPathStr, jsonSpan_st *ps_value, bool needSpan_b8, bool *pMalformed_b8)
+{
+    jsonIter_st s_iter;
+    jsonSpan_st s_key;
+    const char *pValueStr;
+
+    *pMalformed_b8 = false;
+    if (pJsonStr == NULL)
+    {
+        return false;
+    }
+
+    pJsonStr = json_skipWhiteSpace(pJsonStr);
+    if ((pPathStr == NULL) || (*pPathStr == 0))
+    {
+        if (!needSpan_b8)
+        {
+            return json_enterPath(pJsonStr, ps_value, pMalformed_b8);
+        }
+        *pMalformed_b8 = (json_parseValue(pJsonStr, ps_value) == NULL);
+        return !*pMalformed_b8;
+    }
+
+    if (!json_enterPath(pJsonStr, ps_value, pMalformed_b8))
+    {
+        return false;
+    }
+
+    while (*pPathStr != 0)
+    {
+        if (*pPathStr == '[')
+        {
+            uint32_t index_u32 = 0;
+            const char *pIndexStr = ++pPathStr;
+
+            for (; util_IsAsciiInt(*pPathStr); pPathStr++)
+            {
+                // an array in a span can not hold more elements than the span has bytes
+                if (index_u32 > LENGTH_SPAN_MAX)
+                {
+                    return false;
+                }
+                index_u32 = (index_u32 * 10) + util_Ascii2Dec(*pPathStr);
+            }
+            if ((pPathStr == pIndexStr) || (*pPathStr++ != ']') ||
+                !json_iterBegin(&s_iter, ps_value, JSON_TYPE_ARRAY))
+            {
+                return false;
+            }
+
+            // skip the elements before the index
+            for (; index_u32; index_u32--)
+            {
+                if (!json_iterNext(&s_iter, NULL, ps_value))
+                {
+                    *pMalformed_b8 = s_iter.error_b8;
+                    return false;
+                }
+            }
+            pValueStr = json_iterSeek(&s_iter, NULL);
+        }
+        else
+        {
+            const char *pKeyStr = pPathStr;
+
+            while ((*pPathStr != 0) && (*pPathStr != '.') && (*pPathStr != '['))
+            {
+                pPathStr++;
+            }
+            if (!json_iterBegin(&s_iter, ps_value, JSON_TYPE_OBJECT))
+            {
+                return false;
+            }
+
+            // skip the members until the key matches
+            while (((pValueStr = json_iterSeek(&s_iter, &s_key)) != NULL) &&
+                   !json_spanEquals(&s_key, pKeyStr, (uint16_t)(pPathStr - pKeyStr)))
+            {
+                if (!json_iterFinish(&s_iter, pValueStr, ps_value))
+                {
+                    *pMalformed_b8 = true;
+                    return false;
+                }
+            }
+        }
+
+        if (pValueStr == NULL)
+        {
+            *pMalformed_b8 = s_iter.error_b8;
+            return false;
+        }
+
+        if (*pPathStr == '.')
+        {
+            pPathStr++;
+        }
+
+        if (*pPathStr != 0)
+        {
+            // intermediate containers are entered without scanning to their end
+            if (!json_enterPath(pValueStr, ps_value, pMalformed_b8))
+            {
+                return false;
+            }
+        }
+        else if (needSpan_b8 || !json_enterContainer(pValueStr, ps_value))
+        {
+            *pMalformed_b8 = (json_parseValue(pValueStr, ps_value) == NULL);
+            return !*pMalformed_b8;
+        }
+    }
+
+    return true;
+}
+
+/* Global Functions ----------------------------------------------------------*/
+
+bool JSON_getPath(const char *pJsonStr, const char *pPathStr, jsonSpan_st *ps_value)
+{
+    bool malformed_b8;
+
+    return json_locate(pJsonStr, pPathStr, ps_value, true, &malformed_b8);
+}
+
+bool JSON_arrayBegin(jsonIter_st *ps_iter, const char *pJsonStr, const char *pPathStr)
+{
+    jsonSpan_st s_array = {0};
+    bool malformed_b8;
+
+    if (!json_locate(pJsonStr, pPathStr, &s_array, false, &malformed_b8))
+    {
+        memset(ps_iter, 0, sizeof(jsonIter_st));
+        ps_iter->error_b8 = true;
+        return false;
+    }
+
+    return json_iterBegin(ps_iter, &s_array, JSON_TYPE_ARRAY);
+}
+
+bool JSON_arrayNext(jsonIter_st *ps_iter, jsonSpan_st *ps_value)
+{
+    return !ps_iter->isObject_b8 && json_iterNext(ps_iter, NULL, ps_value);
+}
+
+bool JSON_objectBegin(jsonIter_st *ps_iter, const char *pJsonStr, const char *pPathStr)
+{
+    jsonSpan_st s_object = {0};
+    bool malformed_b8;
+
+    if (!json_locate(pJsonStr, pPathStr, &s_object, false, &malformed_b8))
+    {
+        memset(ps_iter, 0, sizeof(jsonIter_st));
+        ps_iter->error_b8 = true;
+        return false;
+    }
+
+    return json_iterBegin(ps_iter, &s_object, JSON_TYPE_OBJECT);
+}
+
+bool JSON_objectNext(jsonIter_st *ps_iter, jsonSpan_st *ps_key, jsonSpan_st *ps_value)
+{
+    return ps_iter->isObject_b8 && json_iterNext(ps_iter, ps_key, ps_value);
+}
+
+bool JSON_spanCopy(const jsonSpan_st *ps_span, char *pBuffStr, uint16_t size_u16)
+{
+    const char *pStr = ps_span->pStr;
+    const char *pEnd = ps_span->pStr + ps_span->len_u16;
+    uint16_t len_u16 = 0;
+
+    if ((pBuffStr == NULL) || (size_u16 == 0))
+    {
+        return false;
+    }
+
+    while (pStr < pEnd)
+    {
+        char decoded[4];
+        uint8_t consumed_u8 = 0;
+        uint8_t decodedLen_u8 = 1;
+
+        if ((ps_span->type_e == JSON_TYPE_STRING) && (*pStr == '\\'))
+        {
+            decodedLen_u8 = json_decodeEscape(pStr + 1, pEnd, decoded, &consumed_u8);
+            if (decodedLen_u8 == 0)
+            {
+                pBuffStr[0] = 0;
+                return false;
+            }
+        }
+        else
+        {
+            decoded[0] = *pStr;
+        }
+
+        if ((len_u16 + decodedLen_u8) >= size_u16)
+        {
+            pBuffStr[0] = 0;
+            return false;
+        }
+
+        memcpy(&pBuffStr[len_u16], decoded, decodedLen_u8);
+        len_u16 += decodedLen_u8;
+        pStr += consumed_u8 + 1;
+    }
+
+    pBuffStr[len_u16] = 0;
+    return true;
+}
+
+bool JSON_bind(const char *pJsonStr, const char *pPathStr, const jsonBinding_st as_bindings[], uint8_t maxBindings_u8, void *pStruct, uint32_t *pFoundMask_u32)
+{
+    jsonIter_st s_iter;
+    jsonSpan_st s_key;
+    jsonSpan_st s_value;
+    uint32_t foundMask_u32 = 0;
+    bool status_b8 = true;
+
+    if (pFoundMask_u32 != NULL)
+    {
+        *pFoundMask_u32 = 0;
+    }
+
+    if ((maxBindings_u8 > JSON_BIND_MAX) || (pStruct == NULL) ||
+        !JSON_objectBegin(&s_iter, pJsonStr, pPathStr))
+    {
+        return false;
+    }
+
+    while (JSON_objectNext(&s_iter, &s_key, &s_value))
+    {
+        for (uint8_t i = 0; i < maxBindings_u8; i++)
+        {
+            const jsonBinding_st *ps_binding = &as_bindings[i];
+            uint8_t *pField_u8 = (uint8_t *)pStruct + ps_binding->offset_u16;
+
+            if (!json_spanEquals(&s_key, ps_binding->keyStr, (uint16_t)strlen(ps_binding->keyStr)))
+            {
+                continue;
+            }
+
+            if (json_bindValue(ps_binding, &s_value, pField_u8))
+            {
+                foundMask_u32 |= (1u << i);
+            }
+            else
+            {
+                memset(pField_u8, 0, ps_binding->size_u16);
+                foundMask_u32 &= ~(1u << i);
+                status_b8 = false;
+            }
+            break;
+        }
+    }
+
+    if (s_iter.error_b8)
+    {
+        status_b8 = false;
+    }
+
+    if (pFoundMask_u32 != NULL)
+    {
+        *pFoundMask_u32 = foundMask_u32;
+    }
+
+    return status_b8;
+}
+
+void JSON_parserInit(jsonParser_st *ps_parser, const char *pJsonStr)
+{
+    memset(ps_parser, 0, sizeof(jsonParser_st));
+    ps_parser->pJsonStr = pJsonStr;
+    ps_parser->error_b8 = (pJsonStr == NULL);
+}
+
+bool JSON_parserGetPath(jsonParser_st *ps_parser, const char *pPathStr, jsonSpan_st *ps_value)
+{
+    bool malformed_b8 = false;
+    bool status_b8 = !ps_parser->error_b8 &&
+                     json_locate(ps_parser->pJsonStr, pPathStr, ps_value, true, &malformed_b8);
+
+    if (malformed_b8)
+    {
+        ps_parser->error_b8 = true;
+    }
+
+    return status_b8;
+}
+
+uint8_t JSON_parserTags(jsonParser_st *ps_parser, const char *pPathStr, const jsonTag_st as_tags[], uint8_t maxTags_u8)
+{
+    jsonIter_st s_iter;
+    jsonSpan_st s_key;
+    jsonSpan_st s_value;
+    jsonSpan_st s_object = {0};
+    uint32_t foundMask_u32 = 0;
+    uint32_t failMask_u32 = 0;
+    uint8_t found_u8 = 0;
+    bool malformed_b8 = false;
+
+    if (maxTags_u8 > JSON_BIND_MAX)
+    {
+        maxTags_u8 = JSON_BIND_MAX;
+    }
+
+    for (uint8_t i = 0; i < maxTags_u8; i++)
+    {
+        if ((as_tags[i].pValueStr != NULL) && (as_tags[i].size_u16 != 0))
+        {
+            as_tags[i].pValueStr[0] = 0;
+        }
+    }
+
+    ps_parser->foundMask_u32 = 0;
+    ps_parser->failMask_u32 = 0;
+    if (ps_parser->error_b8)
+    {
+        return 0;
+    }
+
+    if (!json_locate(ps_parser->pJsonStr, pPathStr, &s_object, false, &malformed_b8) ||
+        !json_iterBegin(&s_iter, &s_object, JSON_TYPE_OBJECT))
+    {
+        // not found or not an object is reported by the return only
+        ps_parser->error_b8 = malformed_b8;
+        return 0;
+    }
+
+    while (JSON_objectNext(&s_iter, &s_key, &s_value))
+    {
+        for (uint8_t i = 0; i < maxTags_u8; i++)
+        {
+            const jsonTag_st *ps_tag = &as_tags[i];
+
+            if (!json_spanEquals(&s_key, ps_tag->keyStr, (uint16_t)strlen(ps_tag->keyStr)))
+            {
+                continue;
+            }
+
+            if (JSON_spanCopy(&s_value, ps_tag->pValueStr, ps_tag->size_u16))
+            {
+                foundMask_u32 |= (1u << i);
+                failMask_u32 &= ~(1u << i);
+            }
+            else
+            {
+                // the document is fine, only this tag failed
+                foundMask_u32 &= ~(1u << i);
+                failMask_u32 |= (1u << i);
+            }
+            break;
+        }
+    }
+
+    if (s_iter.error_b8)
+    {
+        ps_parser->error_b8 = true;
+    }
+
+    for (uint32_t mask_u32 = foundMask_u32; mask_u32; mask_u32 &= (mask_u32 - 1))
+    {
+        found_u8++;
+    }
+    ps_parser->foundMask_u32 = foundMask_u32;
+    ps_parser->failMask_u32 = failMask_u32;
+
+    return found_u8;
+}
@@ -0,0 +1,382 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file lib_jsonWriter.c
+ * \brief Json writer library source file.
+ *
+ * Allocation free JSON writer, see lib_jsonWriter.h for the api.
+ *
+ * The libraries have been tested on the ESP32 modules.
+ * Buildstorm explicitly denies responsibility for any hardware failures
+ * arising from the use of these libraries, whether directly or indirectly.
+ *
+ * EULA LICENSE:
+ * This library is licensed under end user license EULA agreement.
+ * The EULA is available at https://buildstorm.com/eula/
+ * For any support contact us at hello@buildstorm.com
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+
+#include "lib_jsonWriter.h"
+
+/* Macros ------------------------------------------------------------------*/
+#define LENGTH_NUM_BUFFER 24 // "-4294967295.999999" fits with margin
+
+/* Variables -----------------------------------------------------------------*/
+static const uint32_t s_pow10_u32[JSON_WRITER_MAX_DEC_POINTS + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+static const char s_hexChars[] = "0123456789abcdef";
+
+/* Local Functions ----------------------------------------------------------*/
+
+static bool json_put(jsonWriter_st *ps_writer, const char *pData, uint16_t len_u16)
+{
+    if ((uint32_t)ps_writer->len_u16 + len_u16 >= ps_writer->size_u16)
+    {
+        ps_writer->error_b8 = true;
+        return false;
+    }
+
+    memcpy(&ps_writer->pBuffStr[ps_writer->len_u16], pData, len_u16);
+    ps_writer->len_u16 += len_u16;
+    ps_writer->pBuffStr[ps_writer->len_u16] = 0;
+
+    return true;
+}
+
+static bool json_putChar(jsonWriter_st *ps_writer, char ch)
+{
+    return json_put(ps_writer, &ch, 1);
+}
+
+/* Writes the comma separator if needed and checks the call sequence */
+static bool json_beginElement(jsonWriter_st *ps_writer, bool isKey_b8)
+{
+    uint8_t depth_u8 = ps_writer->depth_u8;
+    bool inObject_b8 = (depth_u8 > 0) && util_IsBitSet(ps_writer->objectMask_u16, depth_u8 - 1);
+
+    if (ps_writer->error_b8)
+    {
+        return false;
+    }
+
+    if (inObject_b8 && !isKey_b8 && ps_writer->keyPending_b8)
+    {
+        // value of the pending key, no separator
+        ps_writer->keyPending_b8 = false;
+        return true;
+    }
+
+    if ((inObject_b8 != isKey_b8) || ps_writer->keyPending_b8)
+    {
+        // key outside an object, value without key or key after key
+        ps_writer->error_b8 = true;
+        return false;
+    }
+
+    if (depth_u8 == 0)
+    {
+        if (ps_writer->len_u16 != 0)
+        {
+            // only one top level value
+            ps_writer->error_b8 = true;
+            return false;
+        }
+        return true;
+    }
+
+    if (util_IsBitSet(ps_writer->commaMask_u16, depth_u8 - 1))
+    {
+        return json_putChar(ps_writer, ',');
+    }
+
+    util_BitSet(ps_writer->commaMask_u16, depth_u8 - 1);
+    return true;
+}
+
+static bool json_open(jsonWriter_st *ps_writer, char ch, bool isObject_b8)
+{
+    if (!json_beginElement(ps_writer, false))
+    {
+        return false;
+    }
+
+    if (ps_writer->depth_u8 >= JSON_WRITER_MAX_DEPTH)
+    {
+        ps_writer->error_b8 = true;
+        return false;
+    }
+
+    util_UpdateBit(ps_writer->objectMask_u16, ps_writer->depth_u8, isObject_b8);
+    util_BitClear(ps_writer->commaMask_u16, ps_writer->depth_u8);
+    ps_writer->depth_u8++;
+
+    return json_putChar(ps_writer, ch);
+}
+
+static bool json_close(jsonWriter_st *ps_writer, char ch, bool isObject_b8)
+{
+    if (ps_writer->error_b8 ||
+        (ps_writer->depth_u8 == 0) ||
+        ps_writer->keyPending_b8 ||
+        (util_IsBitSet(ps_writer->objectMask_u16, ps_writer->depth_u8 - 1) != isObject_b8))
+    {
+        ps_writer->error_b8 = true;
+        return false;
+    }
+
+    ps_writer->depth_u8--;
+
+    return json_putChar(ps_writer, ch);
+}
+
+/* Writes the digits of value_u32 right aligned ending at pEnd, returns the first digit */
+static char *json_formatU32(char *pEnd, uint32_t value_u32, uint8_t minDigits_u8)
+{
+    char *pStr = pEnd;
+
+    do
+    {
+        *--pStr = (char)util_Dec2Ascii(value_u32 % 10);
+        value_u32 /= 10;
+    } while (value_u32 || ((pEnd - pStr) < minDigits_u8));
+
+    return pStr;
+}
+
+static bool json_putNumber(jsonWriter_st *ps_writer, bool negative_b8, uint32_t intPart_u32, uint32_t fracPart_u32, uint8_t decPoints_u8)
+{
+    char numBuff[LENGTH_NUM_BUFFER];
+    char *pEnd = &numBuff[LENGTH_NUM_BUFFER];
+    char *pStr = pEnd;
+
+    if (decPoints_u8)
+    {
+        pStr = json_formatU32(pStr, fracPart_u32, decPoints_u8);
+        *--pStr = '.';
+    }
+
+    pStr = json_formatU32(pStr, intPart_u32, 1);
+
+    if (negative_b8)
+    {
+        *--pStr = '-';
+    }
+
+    return json_beginElement(ps_writer, false) && json_put(ps_writer, pStr, (uint16_t)(pEnd - pStr));
+}
+
+static bool json_putEscaped(jsonWriter_st *ps_writer, const char *pStr)
+{
+    const char *pRun = pStr;
+    char escBuff[6] = {'\\', 'u', '0', '0', 0, 0};
+    uint16_t escLen_u16;
+
+    if (!json_putChar(ps_writer, '"'))
+    {
+        return false;
+    }
+
+    for (;; pStr++)
+    {
+        uint8_t ch_u8 = (uint8_t)*pStr;
+
+        if ((ch_u8 >= 0x20) && (ch_u8 != '"') && (ch_u8 != '\\'))
+        {
+            continue;
+        }
+
+        // flush the run of plain characters before this one
+        if ((pStr != pRun) && !json_put(ps_writer, pRun, (uint16_t)(pStr - pRun)))
+        {
+            return false;
+        }
+
+        if (ch_u8 == 0)
+        {
+            break;
+        }
+
+        escLen_u16 = 2;
+        switch (ch_u8)
+        {
+        case '"':
+        case '\\':
+            escBuff[1] = (char)ch_u8;
+            break;
+        case '\b':
+            escBuff[1] = 'b';
+            break;
+        case '\f':
+            escBuff[1] = 'f';
+            break;
+        case '\n':
+            escBuff[1] = 'n';
+            break;
+        case '\r':
+            escBuff[1] = 'r';
+            break;
+        case '\t':
+            escBuff[1] = 't';
+            break;
+        default:
+            escBuff[1] = 'u';
+            escBuff[4] = s_hexChars[ch_u8 >> 4];
+            escBuff[5] = s_hexChars[ch_u8 & 0x0F];
+            escLen_u16 = 6;
+            break;
+        }
+
+        if (!json_put(ps_writer, escBuff, escLen_u16))
+        {
+            return false;
+        }
+        pRun = pStr + 1;
+    }
+
+    return json_putChar(ps_writer, '"');
+}
+
+/* Global Functions ----------------------------------------------------------*/
+
+void JSON_writerInit(jsonWriter_st *ps_writer, char *pBuffStr, uint16_t size_u16)
+{
+    memset(ps_writer, 0, sizeof(jsonWriter_st));
+    ps_writer->pBuffStr = pBuffStr;
+    ps_writer->size_u16 = size_u16;
+
+    if ((pBuffStr == NULL) || (size_u16 == 0))
+    {
+        ps_writer->error_b8 = true;
+    }
+    else
+    {
+        pBuffStr[0] = 0;
+    }
+}
+
+uint16_t JSON_writerEnd(jsonWriter_st *ps_writer)
+{
+    if (ps_writer->error_b8 || ps_writer->depth_u8 || ps_writer->keyPending_b8)
+    {
+        return 0;
+    }
+
+    return ps_writer->len_u16;
+}
+
+bool JSON_writeObjectStart(jsonWriter_st *ps_writer)
+{
+    return json_open(ps_writer, '{', true);
+}
+
+bool JSON_writeObjectEnd(jsonWriter_st *ps_writer)
+{
+    return json_close(ps_writer, '}', true);
+}
+
+bool JSON_writeArrayStart(jsonWriter_st *ps_writer)
+{
+    return json_open(ps_writer, '[', false);
+}
+
+bool JSON_writeArrayEnd(jsonWriter_st *ps_writer)
+{
+    return json_close(ps_writer, ']', false);
+}
+
+bool JSON_writeKey(jsonWriter_st *ps_writer, const char *pKeyStr)
+{
+    if (pKeyStr == NULL)
+    {
+        ps_writer->error_b8 = true;
+        return false;
+    }
+
+    if (!json_beginElement(ps_writer, true) ||
+        !json_putEscaped(ps_writer, pKeyStr) ||
+        !json_putChar(ps_writer, ':'))
+    {
+        return false;
+    }
+
+    ps_writer->keyPending_b8 = true;
+    return true;
+}
+
+bool JSON_writeInt(jsonWriter_st *ps_writer, int32_t value_i32)
+{
+    // negate in unsigned space so INT32_MIN does not overflow
+    uint32_t abs_u32 = (value_i32 < 0) ? (0u - (uint32_t)value_i32) : (uint32_t)value_i32;
+
+    return json_putNumber(ps_writer, (value_i32 < 0), abs_u32, 0, 0);
+}
+
+bool JSON_writeUint(jsonWriter_st *ps_writer, uint32_t value_u32)
+{
+    return json_putNumber(ps_writer, false, value_u32, 0, 0);
+}
+
+bool JSON_writeFloat(jsonWriter_st *ps_writer, float value_f32, uint8_t decPoints_u8)
+{
+    bool negative_b8 = (value_f32 < 0);
+    uint32_t scale_u32;
+    uint32_t intPart_u32;
+    uint32_t fracPart_u32;
+
+    if (decPoints_u8 > JSON_WRITER_MAX_DEC_POINTS)
+    {
+        decPoints_u8 = JSON_WRITER_MAX_DEC_POINTS;
+    }
+    scale_u32 = s_pow10_u32[decPoints_u8];
+
+    if (negative_b8)
+    {
+        value_f32 = -value_f32;
+    }
+
+    // NaN fails every comparison, infinity and huge values fail the range check
+    if (!(value_f32 < 4294967040.0f))
+    {
+        return JSON_writeNull(ps_writer);
+    }
+
+    // split first so the fraction keeps the precision of a small float
+    intPart_u32 = (uint32_t)value_f32;
+    fracPart_u32 = (uint32_t)((value_f32 - (float)intPart_u32) * (float)scale_u32 + 0.5f);
+    if (fracPart_u32 >= scale_u32)
+    {
+        fracPart_u32 -= scale_u32;
+        if (intPart_u32 == UINT32_MAX)
+        {
+            return JSON_writeNull(ps_writer);
+        }
+        intPart_u32++;
+    }
+
+    // no "-0.00" for values that round to zero
+    if ((intPart_u32 == 0) && (fracPart_u32 == 0))
+    {
+        negative_b8 = false;
+    }
+
+    return json_putNumber(ps_writer, negative_b8, intPart_u32, fracPart_u32, decPoints_u8);
+}
+
+bool JSON_writeBool(jsonWriter_st *ps_writer, bool value_b8)
+{
+    return json_beginElement(ps_writer, false) &&
+           (value_b8 ? json_put(ps_writer, "true", 4) : json_put(ps_writer, "false", 5));
+}
+
+bool JSON_writeNull(jsonWriter_st *ps_writer)
+{
+    return json_beginElement(ps_writer, false) && json_put(ps_writer, "null", 4);
+}
+
+bool JSON_writeString(jsonWriter_st *ps_writer, const char *pStr)
+{
+    return json_beginElement(ps_writer, false) && json_putEscaped(ps_writer, (pStr != NULL) ? pStr : "");
+}
@@ -0,0 +1,90 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file bench_jsonWriter.c
+ * \brief Host benchmark of the JSON writer against snprintf for a telemetry payload.
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "lib_jsonWriter.h"
+
+/* Macros ------------------------------------------------------------------*/
+#define BENCH_DOCS 1000000
+#define BENCH_ROUNDS 5 // best of, to hide scheduler noise
+
+/* Local Functions ----------------------------------------------------------*/
+
+static uint16_t bench_writer(char *pBuffStr, uint16_t size_u16, int32_t count_i32)
+{
+    jsonWriter_st s_writer;
+
+    JSON_writerInit(&s_writer, pBuffStr, size_u16);
+    JSON_writeObjectStart(&s_writer);
+    JSON_writeKey(&s_writer, "temp");
+    JSON_writeFloat(&s_writer, 23.5f + (float)count_i32 * 0.001f, 2);
+    JSON_writeKey(&s_writer, "hum");
+    JSON_writeFloat(&s_writer, 45.6f, 1);
+    JSON_writeKey(&s_writer, "cnt");
+    JSON_writeInt(&s_writer, count_i32);
+    JSON_writeKey(&s_writer, "color");
+    JSON_writeString(&s_writer, "RED");
+    JSON_writeObjectEnd(&s_writer);
+
+    return JSON_writerEnd(&s_writer);
+}
+
+static uint16_t bench_snprintf(char *pBuffStr, uint16_t size_u16, int32_t count_i32)
+{
+    return (uint16_t)snprintf(pBuffStr, size_u16, "{\"temp\":%.2f,\"hum\":%.1f,\"cnt\":%d,\"color\":\"%s\"}",
+                              23.5f + (float)count_i32 * 0.001f, 45.6f, (int)count_i32, "RED");
+}
+
+static double bench_run(uint16_t (*pFunc)(char *, uint16_t, int32_t))
+{
+    char buff[128];
+    volatile uint32_t total_u32 = 0;
+    double best = 1e9;
+
+    for (uint8_t round_u8 = 0; round_u8 < BENCH_ROUNDS; round_u8++)
+    {
+        double start = host_now();
+
+        for (int32_t i = 0; i < BENCH_DOCS; i++)
+        {
+            total_u32 += pFunc(buff, sizeof(buff), i);
+        }
+
+        double elapsed = host_now() - start;
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+
+    return best / BENCH_DOCS * 1e9;
+}
+
+/* Global Functions ----------------------------------------------------------*/
+
+int main(void)
+{
+    char writerStr[128];
+    char printfStr[128];
+
+    // both produce the same document, values avoid ties (the writer rounds half away from zero, printf to even)
+    bench_writer(writerStr, sizeof(writerStr), 1234);
+    bench_snprintf(printfStr, sizeof(printfStr), 1234);
+    printf("%s\n", writerStr);
+    if (strcmp(writerStr, printfStr) != 0)
+    {
+        printf("output mismatch: %s\n", printfStr);
+        return 1;
+    }
+
+    printf("JSON writer: %.1f ns/doc\n", bench_run(bench_writer));
+    printf("snprintf   : %.1f ns/doc\n", bench_run(bench_snprintf));
+
+    return 0;
+}
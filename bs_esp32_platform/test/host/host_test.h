@@ -0,0 +1,44 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file host_test.h
+ * \brief Helpers shared by the host tests and benchmarks.
+ *
+ * The open source libraries under lib/src are plain C and are built for the
+ * host by the Makefile in this folder, with the address and undefined
+ * behaviour sanitizers enabled for the tests.
+ *
+ */
+
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static int gTestFails_i32 __attribute__((unused)) = 0;
+
+#define TEST_CHECK(cond)                                              \
+    do                                                                \
+    {                                                                 \
+        if (!(cond))                                                  \
+        {                                                             \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);    \
+            gTestFails_i32++;                                         \
+        }                                                             \
+    } while (0)
+
+#define TEST_RESULT(nameStr)                                                 \
+    (printf("%s: %s\n", nameStr, gTestFails_i32 ? "FAILED" : "passed"), \
+     (gTestFails_i32 ? 1 : 0))
+
+static inline double host_now(void)
+{
+    struct timespec s_time;
+
+    clock_gettime(CLOCK_MONOTONIC, &s_time);
+    return (double)s_time.tv_sec + ((double)s_time.tv_nsec * 1e-9);
+}
+
+#endif //_HOST_TEST_H_
@@ -0,0 +1,69 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file scan_jsonReader.c
+ * \brief Prints the reader results for pseudo random inputs. The Makefile builds it
+ * once per scan mode and compares the outputs, both scan loops must agree.
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "lib_jsonReader.h"
+
+/* Macros ------------------------------------------------------------------*/
+#define SCAN_INPUTS 300000
+#define SCAN_MAX_LEN 70
+
+/* Variables -----------------------------------------------------------------*/
+static uint32_t gSeed_u32 = 1;
+
+/* Local Functions ----------------------------------------------------------*/
+
+/* Fixed generator so both builds see the same inputs */
+static uint32_t scan_random(void)
+{
+    gSeed_u32 = (gSeed_u32 * 1103515245u) + 12345u;
+    return gSeed_u32 >> 16;
+}
+
+/* Global Functions ----------------------------------------------------------*/
+
+int main(void)
+{
+    // structural characters, escapes and the bytes the word bracket test flags falsely
+    static const char alphabetStr[] = "{}[]\",:\\ aYy_1tn";
+    char buff[SCAN_MAX_LEN + 8];
+
+    for (uint32_t n = 0; n < SCAN_INPUTS; n++)
+    {
+        // vary the alignment, the word loop starts on an aligned address
+        char *pStr = &buff[scan_random() % 4];
+        uint32_t len_u32 = scan_random() % SCAN_MAX_LEN;
+        jsonSpan_st s_value;
+        jsonSpan_st s_element;
+        jsonIter_st s_iter;
+        int count_i32 = 0;
+        bool found_b8;
+
+        for (uint32_t i = 0; i < len_u32; i++)
+        {
+            pStr[i] = alphabetStr[scan_random() % (sizeof(alphabetStr) - 1)];
+        }
+        pStr[len_u32] = 0;
+
+        found_b8 = JSON_getPath(pStr, NULL, &s_value);
+        if (JSON_arrayBegin(&s_iter, pStr, NULL))
+        {
+            while (JSON_arrayNext(&s_iter, &s_element))
+            {
+                count_i32++;
+            }
+        }
+
+        printf("%d %u %d %d %d\n", found_b8, found_b8 ? s_value.len_u16 : 0u,
+               found_b8 ? (int)s_value.type_e : 0, count_i32, s_iter.error_b8);
+    }
+
+    return 0;
+}
@@ -0,0 +1,16 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file esp_types.h
+ * \brief Host stand-in for the ESP-IDF esp_types.h, only for the host tests.
+ *
+ */
+
+#ifndef _HOST_ESP_TYPES_H_
+#define _HOST_ESP_TYPES_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#endif //_HOST_ESP_TYPES_H_
@@ -0,0 +1,147 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file test_jsonBind.c
+ * \brief Host tests for the JSON binding tables of the JSON reader library.
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host_test.h"
+#include "lib_jsonReader.h"
+
+/* Variables -----------------------------------------------------------------*/
+typedef struct
+{
+    uint32_t count_u32;
+    uint16_t onTime_u16;
+    uint8_t offTime_u8;
+    int32_t temp_i32;
+    float gain_f32;
+    bool enable_b8;
+    char nameStr[8];
+} testConfig_st;
+
+typedef enum
+{
+    CONFIG_BIND_COUNT,
+    CONFIG_BIND_ON_TIME,
+    CONFIG_BIND_OFF_TIME,
+    CONFIG_BIND_TEMP,
+    CONFIG_BIND_GAIN,
+    CONFIG_BIND_ENABLE,
+    CONFIG_BIND_NAME,
+    CONFIG_BIND_MAX
+} testConfigBind_et;
+
+static const jsonBinding_st as_configBindings[CONFIG_BIND_MAX] = {
+    [CONFIG_BIND_COUNT] = JSON_BIND(testConfig_st, "count", JSON_BIND_TYPE_U32, count_u32),
+    [CONFIG_BIND_ON_TIME] = JSON_BIND(testConfig_st, "onTime", JSON_BIND_TYPE_U16, onTime_u16),
+    [CONFIG_BIND_OFF_TIME] = JSON_BIND(testConfig_st, "offTime", JSON_BIND_TYPE_U8, offTime_u8),
+    [CONFIG_BIND_TEMP] = JSON_BIND(testConfig_st, "t", JSON_BIND_TYPE_I32, temp_i32),
+    [CONFIG_BIND_GAIN] = JSON_BIND(testConfig_st, "f", JSON_BIND_TYPE_FLOAT, gain_f32),
+    [CONFIG_BIND_ENABLE] = JSON_BIND(testConfig_st, "en", JSON_BIND_TYPE_BOOL, enable_b8),
+    [CONFIG_BIND_NAME] = JSON_BIND(testConfig_st, "name", JSON_BIND_TYPE_STRING, nameStr),
+};
+#define CONFIG_BINDINGS CONFIG_BIND_MAX
+
+/* Local Functions ----------------------------------------------------------*/
+
+static void test_bind(void)
+{
+    testConfig_st s_config;
+    uint32_t foundMask_u32;
+
+    memset(&s_config, 0, sizeof(s_config));
+    TEST_CHECK(JSON_bind("{\"action\":\"blink\",\"count\":3,\"onTime\":\"1250\",\"offTime\":200,\"t\":-2147483648,"
+                         "\"f\":-1.5e2,\"en\":true,\"name\":\"a\\\"b\"}",
+                         NULL, as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+    TEST_CHECK(foundMask_u32 == 0x7F);
+    TEST_CHECK((s_config.count_u32 == 3) && (s_config.onTime_u16 == 1250) && (s_config.offTime_u8 == 200));
+    TEST_CHECK((s_config.temp_i32 == INT32_MIN) && (s_config.gain_f32 == -150.0f) && s_config.enable_b8);
+    TEST_CHECK(strcmp(s_config.nameStr, "a\"b") == 0);
+
+    // failing fields are zeroed, absent fields untouched
+    memset(&s_config, 0, sizeof(s_config));
+    s_config.count_u32 = 9;
+    s_config.offTime_u8 = 7;
+    TEST_CHECK(!JSON_bind("{\"offTime\":256,\"name\":\"12345678\",\"onTime\":1.5}",
+                          NULL, as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+    TEST_CHECK((foundMask_u32 == 0) && (s_config.count_u32 == 9) && (s_config.offTime_u8 == 0) && (s_config.nameStr[0] == 0));
+
+    TEST_CHECK(!JSON_bind("{\"count\":4294967296}", NULL, as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+    TEST_CHECK(JSON_bind("{\"count\":4294967295}", NULL, as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+    TEST_CHECK((foundMask_u32 == 1) && (s_config.count_u32 == UINT32_MAX));
+    TEST_CHECK(!JSON_bind("{\"count\":-1}", NULL, as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+    TEST_CHECK(JSON_bind("{\"x\":{\"t\":\"-5\",\"en\":0}}", "x", as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+    TEST_CHECK((foundMask_u32 == 0x28) && (s_config.temp_i32 == -5) && !s_config.enable_b8);
+
+    TEST_CHECK(!JSON_bind("[1]", NULL, as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+    TEST_CHECK(!JSON_bind("{\"count\":3,", NULL, as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+
+    // argument errors
+    foundMask_u32 = 0xFF;
+    TEST_CHECK(!JSON_bind("{\"count\":1}", NULL, as_configBindings, JSON_BIND_MAX + 1, &s_config, &foundMask_u32));
+    TEST_CHECK(foundMask_u32 == 0);
+    TEST_CHECK(!JSON_bind("{\"count\":1}", NULL, as_configBindings, CONFIG_BINDINGS, NULL, NULL));
+}
+
+
+static void test_bindFloat(void)
+{
+    testConfig_st s_config;
+    uint32_t foundMask_u32;
+
+    const struct
+    {
+        const char *pJsonStr;
+        float value_f32;
+    } as_valid[] = {
+        {"{\"f\":0}", 0.0f},
+        {"{\"f\":-0.5}", -0.5f},
+        {"{\"f\":2.5e3}", 2500.0f},
+        {"{\"f\":\"1.25\"}", 1.25f},
+        {"{\"f\":3.4e38}", 3.4e38f},
+    };
+
+    const char *as_invalid[] = {
+        "{\"f\":1e99}",       // overflows float
+        "{\"f\":-1e99}",      // overflows float
+        "{\"f\":1e-60}",      // underflows float
+        "{\"f\":-inf}",       // not JSON
+        "{\"f\":0x1p4}",      // not JSON
+        "{\"f\":\"nan\"}",    // strtof would take it
+        "{\"f\":\"inf\"}",    // strtof would take it
+        "{\"f\":\"0x1p4\"}",  // strtof would take it
+        "{\"f\":\" 1\"}",     // strtof skips the blank
+        "{\"f\":\"1e99\"}",   // overflows float
+        "{\"f\":true}",       // wrong type
+    };
+
+    for (size_t i = 0; i < sizeof(as_valid) / sizeof(as_valid[0]); i++)
+    {
+        memset(&s_config, 0, sizeof(s_config));
+        TEST_CHECK(JSON_bind(as_valid[i].pJsonStr, NULL, as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+        TEST_CHECK(util_IsBitSet(foundMask_u32, CONFIG_BIND_GAIN) && (s_config.gain_f32 == as_valid[i].value_f32));
+    }
+
+    for (size_t i = 0; i < sizeof(as_invalid) / sizeof(as_invalid[0]); i++)
+    {
+        memset(&s_config, 0, sizeof(s_config));
+        s_config.gain_f32 = 1.0f;
+        TEST_CHECK(!JSON_bind(as_invalid[i], NULL, as_configBindings, CONFIG_BINDINGS, &s_config, &foundMask_u32));
+        TEST_CHECK(!util_IsBitSet(foundMask_u32, CONFIG_BIND_GAIN));
+        // zeroed when the value is rejected, untouched when the JSON itself is invalid
+        TEST_CHECK((s_config.gain_f32 == 0.0f) || (s_config.gain_f32 == 1.0f));
+    }
+}
+
+/* Global Functions ----------------------------------------------------------*/
+
+int main(void)
+{
+    test_bind();
+    test_bindFloat();
+
+    return TEST_RESULT((JSON_READER_WORD_SCAN == TRUE) ? "test_jsonBind (word scan)" : "test_jsonBind (byte scan)");
+}
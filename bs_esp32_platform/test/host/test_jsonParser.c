@@ -0,0 +1,158 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file test_jsonParser.c
+ * \brief Host tests for the reentrant JSON parser context of the JSON reader library.
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+
+#include "host_test.h"
+#include "lib_jsonReader.h"
+
+/* Macros ------------------------------------------------------------------*/
+#define TEST_THREADS 4
+#define TEST_THREAD_DOCS 20000
+
+/* Local Functions ----------------------------------------------------------*/
+
+static bool test_spanIs(const jsonSpan_st *ps_span, const char *pStr)
+{
+    return (ps_span->len_u16 == strlen(pStr)) && (memcmp(ps_span->pStr, pStr, ps_span->len_u16) == 0);
+}
+
+static void test_parser(void)
+{
+    jsonParser_st s_parser;
+    jsonSpan_st s_value;
+    char countStr[8];
+    char shortStr[4];
+    char noneStr[8];
+    const jsonTag_st as_tags[] = {
+        {"count", countStr, sizeof(countStr)},
+        {"str", shortStr, sizeof(shortStr)},
+        {"none", noneStr, sizeof(noneStr)},
+    };
+
+    JSON_parserInit(&s_parser, "{\"count\":1000,\"obj\":{\"str\":\"a\\\"b\"},\"str\":\"abc\"}");
+    TEST_CHECK(JSON_parserTags(&s_parser, NULL, as_tags, 3) == 2);
+    TEST_CHECK((strcmp(countStr, "1000") == 0) && (strcmp(shortStr, "abc") == 0) && (noneStr[0] == 0));
+    TEST_CHECK((s_parser.foundMask_u32 == 0x03) && (s_parser.failMask_u32 == 0) && !s_parser.error_b8);
+    TEST_CHECK(JSON_parserTags(&s_parser, "obj", as_tags, 3) == 1);
+    TEST_CHECK((strcmp(shortStr, "a\"b") == 0) && (countStr[0] == 0) && (s_parser.foundMask_u32 == 0x02));
+    TEST_CHECK(JSON_parserGetPath(&s_parser, "obj.str", &s_value) && (s_value.len_u16 == 4));
+
+    // a value too long for its tag fails only that tag, only for that call
+    JSON_parserInit(&s_parser, "{\"jobId\":\"abc\",\"str\":\"toolong\"}");
+    TEST_CHECK(JSON_parserTags(&s_parser, NULL, as_tags, 3) == 0);
+    TEST_CHECK((s_parser.failMask_u32 == 0x02) && !s_parser.error_b8 && (shortStr[0] == 0));
+    TEST_CHECK(JSON_parserGetPath(&s_parser, "jobId", &s_value) && test_spanIs(&s_value, "abc"));
+    TEST_CHECK((JSON_parserTags(&s_parser, NULL, as_tags, 1) == 0) && (s_parser.failMask_u32 == 0));
+
+    // malformed JSON latches error_b8
+    JSON_parserInit(&s_parser, "{\"count\":1,");
+    TEST_CHECK(JSON_parserTags(&s_parser, NULL, as_tags, 3) == 1);
+    TEST_CHECK(s_parser.error_b8);
+    TEST_CHECK(!JSON_parserGetPath(&s_parser, "count", &s_value));
+
+    JSON_parserInit(&s_parser, NULL);
+    TEST_CHECK(s_parser.error_b8 && (JSON_parserTags(&s_parser, NULL, as_tags, 3) == 0));
+}
+
+static void test_parserMalformed(void)
+{
+    jsonParser_st s_parser;
+    jsonSpan_st s_value;
+    char countStr[8];
+    const jsonTag_st as_tags[] = {
+        {"count", countStr, sizeof(countStr)},
+    };
+
+    // not found or not an object is not an error of the document
+    JSON_parserInit(&s_parser, "{\"a\":1,\"b\":{\"count\":2}}");
+    TEST_CHECK(!JSON_parserGetPath(&s_parser, "nope", &s_value) && !s_parser.error_b8);
+    TEST_CHECK(!JSON_parserGetPath(&s_parser, "a.x", &s_value) && !s_parser.error_b8);
+    TEST_CHECK(!JSON_parserGetPath(&s_parser, "b[0]", &s_value) && !s_parser.error_b8);
+    TEST_CHECK((JSON_parserTags(&s_parser, "a", as_tags, 1) == 0) && !s_parser.error_b8);
+    TEST_CHECK((JSON_parserTags(&s_parser, "y", as_tags, 1) == 0) && !s_parser.error_b8);
+    TEST_CHECK((JSON_parserTags(&s_parser, "b", as_tags, 1) == 1) && (strcmp(countStr, "2") == 0));
+
+    // malformed value at the end of the path
+    JSON_parserInit(&s_parser, "{\"x\":[1,},\"a\":1}");
+    TEST_CHECK(!JSON_parserGetPath(&s_parser, "x", &s_value) && s_parser.error_b8);
+
+    // malformed member skipped on the way to the object
+    JSON_parserInit(&s_parser, "{\"x\":[1,},\"a\":1}");
+    TEST_CHECK((JSON_parserTags(&s_parser, "y", as_tags, 1) == 0) && s_parser.error_b8);
+    TEST_CHECK(!JSON_parserGetPath(&s_parser, "a", &s_value)); // latched
+
+    // malformed element skipped while indexing
+    JSON_parserInit(&s_parser, "{\"l\":[tru,1]}");
+    TEST_CHECK(!JSON_parserGetPath(&s_parser, "l[1]", &s_value) && s_parser.error_b8);
+
+    // malformed root
+    JSON_parserInit(&s_parser, "nul");
+    TEST_CHECK(!JSON_parserGetPath(&s_parser, "a", &s_value) && s_parser.error_b8);
+}
+
+static void *test_parserThread(void *pArg)
+{
+    long id = (long)pArg;
+    char docStr[128];
+    char devStr[8];
+    char numStr[12];
+    char expDevStr[8];
+    char expNumStr[12];
+    const jsonTag_st as_tags[] = {
+        {"dev", devStr, sizeof(devStr)},
+        {"n", numStr, sizeof(numStr)},
+    };
+
+    snprintf(expDevStr, sizeof(expDevStr), "d%ld", id);
+    for (int i = 0; i < TEST_THREAD_DOCS; i++)
+    {
+        jsonParser_st s_parser;
+
+        snprintf(docStr, sizeof(docStr), "{\"dev\":\"d%ld\",\"n\":%d,\"x\":{\"k\":\"v\"}}", id, i);
+        snprintf(expNumStr, sizeof(expNumStr), "%d", i);
+
+        JSON_parserInit(&s_parser, docStr);
+        if ((JSON_parserTags(&s_parser, NULL, as_tags, 2) != 2) ||
+            (strcmp(devStr, expDevStr) != 0) || (strcmp(numStr, expNumStr) != 0))
+        {
+            return (void *)1;
+        }
+    }
+
+    return NULL;
+}
+
+static void test_parserThreads(void)
+{
+    pthread_t threads[TEST_THREADS];
+
+    for (long i = 0; i < TEST_THREADS; i++)
+    {
+        TEST_CHECK(pthread_create(&threads[i], NULL, test_parserThread, (void *)i) == 0);
+    }
+    for (int i = 0; i < TEST_THREADS; i++)
+    {
+        void *pResult = NULL;
+
+        pthread_join(threads[i], &pResult);
+        TEST_CHECK(pResult == NULL);
+    }
+}
+
+/* Global Functions ----------------------------------------------------------*/
+
+int main(void)
+{
+    test_parser();
+    test_parserMalformed();
+    test_parserThreads();
+
+    return TEST_RESULT((JSON_READER_WORD_SCAN == TRUE) ? "test_jsonParser (word scan)" : "test_jsonParser (byte scan)");
+}
@@ -0,0 +1,234 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file test_jsonReader.c
+ * \brief Host tests for the JSON reader library, built once per scan mode.
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+
+#include "host_test.h"
+#include "lib_jsonReader.h"
+
+/* Macros ------------------------------------------------------------------*/
+#define TEST_LONG_ARRAY 70000 // more elements than a uint16_t counts
+
+/* Variables -----------------------------------------------------------------*/
+static const char *pJobDocStr = " {\"timestamp\":1700,\"execution\":{\"jobId\":\"j-1\",\"status\":\"QUEUED\","
+                                "\"jobDocument\":{\"operation\":\"ota\",\"files\":[{\"url\":\"a\"},{\"url\":\"b\"},"
+                                "{\"url\":\"https://x/\\\"q\\\"\",\"size\":-12.5e3}],\"flags\":[true,false,null]}}} ";
+
+/* Local Functions ----------------------------------------------------------*/
+
+static bool test_spanIs(const jsonSpan_st *ps_span, const char *pStr)
+{
+    return (ps_span->len_u16 == strlen(pStr)) && (memcmp(ps_span->pStr, pStr, ps_span->len_u16) == 0);
+}
+
+static void test_getPath(void)
+{
+    jsonSpan_st s_value;
+    char buff[64];
+
+    TEST_CHECK(JSON_getPath(pJobDocStr, "execution.jobDocument.files[2].url", &s_value));
+    TEST_CHECK(s_value.type_e == JSON_TYPE_STRING);
+    TEST_CHECK(JSON_spanCopy(&s_value, buff, sizeof(buff)) && (strcmp(buff, "https://x/\"q\"") == 0));
+    TEST_CHECK(!JSON_spanCopy(&s_value, buff, 5) && (buff[0] == 0));
+
+    TEST_CHECK(JSON_getPath(pJobDocStr, "execution.jobDocument.files[2].size", &s_value));
+    TEST_CHECK((s_value.type_e == JSON_TYPE_NUMBER) && test_spanIs(&s_value, "-12.5e3"));
+    TEST_CHECK(JSON_getPath(pJobDocStr, "timestamp", &s_value) && test_spanIs(&s_value, "1700"));
+    TEST_CHECK(JSON_getPath(pJobDocStr, "execution.jobDocument.flags[2]", &s_value) && (s_value.type_e == JSON_TYPE_NULL));
+    TEST_CHECK(JSON_getPath(pJobDocStr, NULL, &s_value) && (s_value.type_e == JSON_TYPE_OBJECT));
+    TEST_CHECK(s_value.pStr[s_value.len_u16 - 1] == '}');
+
+    TEST_CHECK(!JSON_getPath(pJobDocStr, "execution.jobDocument.files[3]", &s_value));
+    TEST_CHECK(!JSON_getPath(pJobDocStr, "execution.nope", &s_value));
+    TEST_CHECK(!JSON_getPath(pJobDocStr, "timestamp.x", &s_value));
+    TEST_CHECK(!JSON_getPath(pJobDocStr, "execution.jobDocument.files[]", &s_value));
+    TEST_CHECK(!JSON_getPath(pJobDocStr, "execution.jobDocument.files[99999999999999999999]", &s_value));
+
+    TEST_CHECK(!JSON_getPath("{\"a\":[1,2}", "a", &s_value));
+
+    // lazy lookup: nothing after the matched value is validated
+    TEST_CHECK(JSON_getPath("{\"a\":{\"b\":1,\"c\":[}", "a.b", &s_value) && test_spanIs(&s_value, "1"));
+    TEST_CHECK(!JSON_getPath("{\"a\":{\"b\":1,\"c\":[}", "a.c", &s_value));
+    TEST_CHECK(!JSON_getPath("{\"a\":\"unterminated}", "a", &s_value));
+}
+
+static void test_iterate(void)
+{
+    jsonIter_st s_iter;
+    jsonSpan_st s_key;
+    jsonSpan_st s_value;
+    char bigStr[2000];
+    int count_i32 = 0;
+    int len_i32;
+
+    TEST_CHECK(JSON_arrayBegin(&s_iter, pJobDocStr, "execution.jobDocument.files"));
+    while (JSON_arrayNext(&s_iter, &s_value))
+    {
+        jsonSpan_st s_url;
+
+        TEST_CHECK(JSON_getPath(s_value.pStr, "url", &s_url));
+        count_i32++;
+    }
+    TEST_CHECK((count_i32 == 3) && !s_iter.error_b8);
+
+    count_i32 = 0;
+    TEST_CHECK(JSON_objectBegin(&s_iter, pJobDocStr, "execution"));
+    while (JSON_objectNext(&s_iter, &s_key, &s_value))
+    {
+        count_i32++;
+    }
+    TEST_CHECK((count_i32 == 3) && !s_iter.error_b8);
+
+    TEST_CHECK(JSON_arrayBegin(&s_iter, "[ ]", NULL));
+    TEST_CHECK(!JSON_arrayNext(&s_iter, &s_value) && !s_iter.error_b8);
+
+    TEST_CHECK(JSON_arrayBegin(&s_iter, "[1,2 3]", NULL));
+    TEST_CHECK(JSON_arrayNext(&s_iter, &s_value) && JSON_arrayNext(&s_iter, &s_value));
+    TEST_CHECK(!JSON_arrayNext(&s_iter, &s_value) && s_iter.error_b8);
+
+    // arrays are not limited to a fixed number of elements
+    len_i32 = sprintf(bigStr, "{\"l\":[");
+    for (int i = 0; i < 100; i++)
+    {
+        len_i32 += sprintf(&bigStr[len_i32], "%s%d", i ? "," : "", i);
+    }
+    sprintf(&bigStr[len_i32], "]}");
+
+    count_i32 = 0;
+    TEST_CHECK(JSON_arrayBegin(&s_iter, bigStr, "l"));
+    while (JSON_arrayNext(&s_iter, &s_value))
+    {
+        count_i32++;
+    }
+    TEST_CHECK(count_i32 == 100);
+    TEST_CHECK(JSON_getPath(bigStr, "l[99]", &s_value) && test_spanIs(&s_value, "99"));
+}
+
+static void test_longArray(void)
+{
+    char *pArrayStr = malloc((2 * TEST_LONG_ARRAY) + 3);
+    jsonIter_st s_iter;
+    jsonSpan_st s_value;
+    uint32_t count_u32 = 0;
+    char *pStr = pArrayStr;
+
+    *pStr++ = '[';
+    for (uint32_t i = 0; i < TEST_LONG_ARRAY; i++)
+    {
+        *pStr++ = (i != 0) ? ',' : ' ';
+        *pStr++ = '0';
+    }
+    *pStr++ = ']';
+    *pStr = 0;
+
+    TEST_CHECK(JSON_arrayBegin(&s_iter, pArrayStr, NULL));
+    while (JSON_arrayNext(&s_iter, &s_value))
+    {
+        count_u32++;
+    }
+    TEST_CHECK((count_u32 == TEST_LONG_ARRAY) && (s_iter.index_u32 == TEST_LONG_ARRAY) && !s_iter.error_b8);
+
+    free(pArrayStr);
+}
+
+static void test_numbers(void)
+{
+    jsonSpan_st s_value;
+    char docStr[48];
+
+    const char *as_valid[] = {"0", "-0", "7", "-12", "0.5", "-1.25", "1e3", "1E+3", "-2.5e-10", "10"};
+    const char *as_invalid[] = {"-", "01", "-01", "1.", ".5", "1.2.3", "0x1p4", "1e", "1e+", "+1", "1a", "-inf", "NaN", "1..2"};
+
+    for (size_t i = 0; i < sizeof(as_valid) / sizeof(as_valid[0]); i++)
+    {
+        snprintf(docStr, sizeof(docStr), "{\"a\":%s}", as_valid[i]);
+        TEST_CHECK(JSON_getPath(docStr, "a", &s_value));
+        TEST_CHECK((s_value.type_e == JSON_TYPE_NUMBER) && test_spanIs(&s_value, as_valid[i]));
+
+        snprintf(docStr, sizeof(docStr), "[%s ,1]", as_valid[i]);
+        TEST_CHECK(JSON_getPath(docStr, "[0]", &s_value) && test_spanIs(&s_value, as_valid[i]));
+    }
+
+    for (size_t i = 0; i < sizeof(as_invalid) / sizeof(as_invalid[0]); i++)
+    {
+        snprintf(docStr, sizeof(docStr), "{\"a\":%s}", as_invalid[i]);
+        TEST_CHECK(!JSON_getPath(docStr, "a", &s_value));
+    }
+}
+
+static void test_depth(void)
+{
+    char docStr[2 * JSON_READER_MAX_DEPTH + 16];
+    jsonSpan_st s_value;
+    int len_i32;
+
+    // 32 levels including the root object is the limit
+    len_i32 = sprintf(docStr, "{\"a\":");
+    for (int i = 1; i < JSON_READER_MAX_DEPTH; i++)
+    {
+        docStr[len_i32++] = '[';
+    }
+    for (int i = 1; i < JSON_READER_MAX_DEPTH; i++)
+    {
+        docStr[len_i32++] = ']';
+    }
+    strcpy(&docStr[len_i32], "}");
+    TEST_CHECK(JSON_getPath(docStr, NULL, &s_value) && (s_value.type_e == JSON_TYPE_OBJECT));
+
+    len_i32 = 0;
+    for (int i = 0; i <= JSON_READER_MAX_DEPTH; i++)
+    {
+        docStr[len_i32++] = '[';
+    }
+    for (int i = 0; i <= JSON_READER_MAX_DEPTH; i++)
+    {
+        docStr[len_i32++] = ']';
+    }
+    docStr[len_i32] = 0;
+    TEST_CHECK(!JSON_getPath(docStr, NULL, &s_value));
+}
+
+static void test_escapes(void)
+{
+    jsonSpan_st s_value;
+    char buff[16];
+
+    TEST_CHECK(JSON_getPath("{\"s\":\"\\u00e9\\ud83d\\ude00\\n\"}", "s", &s_value));
+    TEST_CHECK(JSON_spanCopy(&s_value, buff, sizeof(buff)) && (strcmp(buff, "\xc3\xa9\xf0\x9f\x98\x80\n") == 0));
+
+    const char *as_invalid[] = {
+        "{\"s\":\"\\uZZZZ\"}",       // not hex
+        "{\"s\":\"a\\u0000b\"}",     // NUL would truncate
+        "{\"s\":\"\\ud83d\"}",       // high surrogate at the end
+        "{\"s\":\"\\ud83dx\"}",      // high surrogate without low
+        "{\"s\":\"\\ud83d\\u0041\"}", // high surrogate with a non surrogate
+        "{\"s\":\"\\ude00\"}",       // lone low surrogate
+        "{\"s\":\"\\q\"}",           // unknown escape
+    };
+
+    for (size_t i = 0; i < sizeof(as_invalid) / sizeof(as_invalid[0]); i++)
+    {
+        TEST_CHECK(JSON_getPath(as_invalid[i], "s", &s_value));
+        TEST_CHECK(!JSON_spanCopy(&s_value, buff, sizeof(buff)) && (buff[0] == 0));
+    }
+}
+
+/* Global Functions ----------------------------------------------------------*/
+
+int main(void)
+{
+    test_getPath();
+    test_iterate();
+    test_longArray();
+    test_numbers();
+    test_depth();
+    test_escapes();
+
+    return TEST_RESULT((JSON_READER_WORD_SCAN == TRUE) ? "test_jsonReader (word scan)" : "test_jsonReader (byte scan)");
+}
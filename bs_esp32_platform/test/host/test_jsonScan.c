@@ -0,0 +1,100 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file test_jsonScan.c
+ * \brief Host tests for the JSON reader scan loops on heap buffers, built once per scan mode.
+ *
+ * MQTT payloads live in heap or static buffers sized to the message, so the
+ * scanners are run on malloc'd copies with the NUL at every offset of a word.
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+
+#include "host_test.h"
+#include "lib_jsonReader.h"
+
+/* Macros ------------------------------------------------------------------*/
+#define TEST_MAX_RUN 40 // string and container runs, covers every NUL offset several times
+
+/* Local Functions ----------------------------------------------------------*/
+
+/* Copies pJsonStr to an exactly sized heap buffer, so any read past the NUL is caught */
+static char *test_heapCopy(const char *pJsonStr)
+{
+    size_t size = strlen(pJsonStr) + 1;
+    char *pCopyStr = malloc(size);
+
+    if (pCopyStr != NULL)
+    {
+        memcpy(pCopyStr, pJsonStr, size);
+    }
+    return pCopyStr;
+}
+
+static void test_heapString(void)
+{
+    char docStr[TEST_MAX_RUN + 32];
+    char valueStr[TEST_MAX_RUN + 1];
+
+    for (int run_i32 = 0; run_i32 <= TEST_MAX_RUN; run_i32++)
+    {
+        jsonSpan_st s_value;
+        char *pHeapStr;
+
+        memset(valueStr, 'a', run_i32);
+        valueStr[run_i32] = 0;
+
+        // complete document, the string scan stops at the closing quote
+        snprintf(docStr, sizeof(docStr), "{\"k\":\"%s\"}", valueStr);
+        pHeapStr = test_heapCopy(docStr);
+        TEST_CHECK(JSON_getPath(pHeapStr, "k", &s_value) && (s_value.len_u16 == run_i32));
+        TEST_CHECK(JSON_getPath(pHeapStr, NULL, &s_value) && (s_value.len_u16 == strlen(docStr)));
+        free(pHeapStr);
+
+        // unterminated string, the scan runs into the NUL
+        snprintf(docStr, sizeof(docStr), "{\"k\":\"%s", valueStr);
+        pHeapStr = test_heapCopy(docStr);
+        TEST_CHECK(!JSON_getPath(pHeapStr, "k", &s_value));
+        TEST_CHECK(!JSON_getPath(pHeapStr, NULL, &s_value));
+        free(pHeapStr);
+    }
+}
+
+static void test_heapContainer(void)
+{
+    char docStr[TEST_MAX_RUN + 32];
+    char runStr[TEST_MAX_RUN + 1];
+
+    for (int run_i32 = 0; run_i32 <= TEST_MAX_RUN; run_i32++)
+    {
+        jsonSpan_st s_value;
+        char *pHeapStr;
+
+        // a run without structural characters, the word loop skips it
+        memset(runStr, '1', run_i32);
+        runStr[run_i32] = 0;
+
+        snprintf(docStr, sizeof(docStr), "[[%s0]]", runStr);
+        pHeapStr = test_heapCopy(docStr);
+        TEST_CHECK(JSON_getPath(pHeapStr, NULL, &s_value) && (s_value.len_u16 == strlen(docStr)));
+        free(pHeapStr);
+
+        // unbalanced, the container scan runs into the NUL
+        snprintf(docStr, sizeof(docStr), "[[%s0]", runStr);
+        pHeapStr = test_heapCopy(docStr);
+        TEST_CHECK(!JSON_getPath(pHeapStr, NULL, &s_value));
+        free(pHeapStr);
+    }
+}
+
+/* Global Functions ----------------------------------------------------------*/
+
+int main(void)
+{
+    test_heapString();
+    test_heapContainer();
+
+    return TEST_RESULT((JSON_READER_WORD_SCAN == TRUE) ? "test_jsonScan (word scan)" : "test_jsonScan (byte scan)");
+}
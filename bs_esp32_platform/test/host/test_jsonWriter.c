@@ -0,0 +1,153 @@
+/**
+ * \copyright Copyright (c) 2019-2024, Buildstorm Pvt Ltd
+ *
+ * \file test_jsonWriter.c
+ * \brief Host tests for the JSON writer library.
+ *
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+
+#include "host_test.h"
+#include "lib_jsonWriter.h"
+
+/* Local Functions ----------------------------------------------------------*/
+
+static void test_document(void)
+{
+    char buff[256];
+    jsonWriter_st s_writer;
+
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    JSON_writeObjectStart(&s_writer);
+    JSON_writeKey(&s_writer, "temp");
+    JSON_writeFloat(&s_writer, -23.456f, 2);
+    JSON_writeKey(&s_writer, "n");
+    JSON_writeInt(&s_writer, INT32_MIN);
+    JSON_writeKey(&s_writer, "u");
+    JSON_writeUint(&s_writer, UINT32_MAX);
+    JSON_writeKey(&s_writer, "s");
+    JSON_writeString(&s_writer, "a\"b\\c\n\x01z");
+    JSON_writeKey(&s_writer, "arr");
+    JSON_writeArrayStart(&s_writer);
+    JSON_writeInt(&s_writer, 1);
+    JSON_writeBool(&s_writer, true);
+    JSON_writeNull(&s_writer);
+    JSON_writeObjectStart(&s_writer);
+    JSON_writeObjectEnd(&s_writer);
+    JSON_writeArrayEnd(&s_writer);
+    JSON_writeObjectEnd(&s_writer);
+
+    TEST_CHECK(JSON_writerEnd(&s_writer) == strlen(buff));
+    TEST_CHECK(strcmp(buff, "{\"temp\":-23.46,\"n\":-2147483648,\"u\":4294967295,"
+                            "\"s\":\"a\\\"b\\\\c\\n\\u0001z\",\"arr\":[1,true,null,{}]}") == 0);
+}
+
+static void test_float(void)
+{
+    char buff[32];
+    jsonWriter_st s_writer;
+
+    struct
+    {
+        float value_f32;
+        uint8_t decPoints_u8;
+        const char *pExpectedStr;
+    } as_cases[] = {
+        {-0.0001f, 2, "0.00"},
+        {9.9999f, 3, "10.000"},
+        {0.1f, 6, "0.100000"},
+        {1.5f, 0, "2"},
+        {12.25f, 9, "12.250000"},
+        {NAN, 3, "null"},
+        {INFINITY, 3, "null"},
+        {5e9f, 1, "null"},
+    };
+
+    for (size_t i = 0; i < sizeof(as_cases) / sizeof(as_cases[0]); i++)
+    {
+        JSON_writerInit(&s_writer, buff, sizeof(buff));
+        TEST_CHECK(JSON_writeFloat(&s_writer, as_cases[i].value_f32, as_cases[i].decPoints_u8));
+        TEST_CHECK(JSON_writerEnd(&s_writer) != 0);
+        TEST_CHECK(strcmp(buff, as_cases[i].pExpectedStr) == 0);
+    }
+}
+
+static void test_overflow(void)
+{
+    char buff[8];
+    jsonWriter_st s_writer;
+
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    JSON_writeObjectStart(&s_writer);
+    JSON_writeKey(&s_writer, "abcdef");
+    JSON_writeInt(&s_writer, 1);
+    JSON_writeObjectEnd(&s_writer);
+    TEST_CHECK(JSON_writerEnd(&s_writer) == 0);
+    TEST_CHECK(strlen(buff) < sizeof(buff));
+
+    // {"a":1} is 7 characters, exact fit with the NUL
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    JSON_writeObjectStart(&s_writer);
+    JSON_writeKey(&s_writer, "a");
+    JSON_writeInt(&s_writer, 1);
+    JSON_writeObjectEnd(&s_writer);
+    TEST_CHECK(JSON_writerEnd(&s_writer) == 7);
+
+    JSON_writerInit(&s_writer, NULL, 0);
+    TEST_CHECK(!JSON_writeInt(&s_writer, 1));
+    TEST_CHECK(JSON_writerEnd(&s_writer) == 0);
+}
+
+static void test_sequence(void)
+{
+    char buff[64];
+    jsonWriter_st s_writer;
+
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    JSON_writeObjectStart(&s_writer);
+    TEST_CHECK(!JSON_writeInt(&s_writer, 1)); // value without key
+    TEST_CHECK(JSON_writerEnd(&s_writer) == 0);
+
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    JSON_writeArrayStart(&s_writer);
+    TEST_CHECK(!JSON_writeKey(&s_writer, "a")); // key inside an array
+
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    JSON_writeArrayStart(&s_writer);
+    TEST_CHECK(!JSON_writeObjectEnd(&s_writer)); // mismatched close
+
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    JSON_writeObjectStart(&s_writer);
+    TEST_CHECK(JSON_writerEnd(&s_writer) == 0); // unbalanced
+
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    JSON_writeInt(&s_writer, 1);
+    TEST_CHECK(!JSON_writeInt(&s_writer, 2)); // second top level value
+
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    JSON_writeObjectStart(&s_writer);
+    TEST_CHECK(!JSON_writeKey(&s_writer, NULL));
+    TEST_CHECK(s_writer.error_b8);
+    TEST_CHECK(!JSON_writeKey(&s_writer, "a")); // error is latched
+
+    JSON_writerInit(&s_writer, buff, sizeof(buff));
+    for (uint8_t i = 0; i < JSON_WRITER_MAX_DEPTH; i++)
+    {
+        TEST_CHECK(JSON_writeArrayStart(&s_writer));
+    }
+    TEST_CHECK(!JSON_writeArrayStart(&s_writer));
+}
+
+/* Global Functions ----------------------------------------------------------*/
+
+int main(void)
+{
+    test_document();
+    test_float();
+    test_overflow();
+    test_sequence();
+
+    return TEST_RESULT("test_jsonWriter");
+}
@@ -18,6 +18,7 @@
 
 #include "lib_system.h"
 #include "lib_jobs.h"
+#include "lib_jsonReader.h"
 #include "lib_gpio.h"
 #include "app_config.h"
 
@@ -37,6 +38,29 @@ static char gJobIdStr[LENGTH_JOB_ID] = {0};
 static char gJobDocumentStr[LENGTH_JOB_DOCUMENT] = {0};
 static bool gJobReceived_b8 = FALSE;
 
+/* Blink job document {"count":3, "onTime":250, "offTime":500} */
+typedef struct
+{
+    uint32_t count_u32;
+    uint32_t onTime_u32;
+    uint32_t offTime_u32;
+} blinkJob_st;
+
+/* Binding index, also the bit in the found mask */
+typedef enum
+{
+    BLINK_JOB_COUNT,
+    BLINK_JOB_ON_TIME,
+    BLINK_JOB_OFF_TIME,
+    BLINK_JOB_BINDINGS
+} blinkJobBind_et;
+
+static const jsonBinding_st blinkJobBindings[BLINK_JOB_BINDINGS] = {
+    [BLINK_JOB_COUNT] = JSON_BIND(blinkJob_st, "count", JSON_BIND_TYPE_U32, count_u32),
+    [BLINK_JOB_ON_TIME] = JSON_BIND(blinkJob_st, "onTime", JSON_BIND_TYPE_U32, onTime_u32),
+    [BLINK_JOB_OFF_TIME] = JSON_BIND(blinkJob_st, "offTime", JSON_BIND_TYPE_U32, offTime_u32),
+};
+
 void app_eventsCallBackHandler(systemEvents_et event_e)
 {
     switch (event_e)
@@ -81,25 +105,16 @@ void app_jobCheck()
     {
         gJobReceived_b8 = FALSE;
 
-        uint32_t countValue_u32 = 0;
-        uint32_t onTime_u32 = 0;
-        uint32_t offTime_u32 = 0;
-        char countStr[4] = {0};
-        char onTimeStr[4] = {0};
-        char offTimeStr[4] = {0};
-
-        // variable for extracting json key-value pair
-        tagStructure_st jobKeyValuePair[3] = {
-            {"count", countStr},
-            {"onTime", onTimeStr},
-            {"offTime", offTimeStr}};
-
-        // parse job document to initialize count value
-        if (JSON_processString(gJobDocumentStr, jobKeyValuePair, 3, FALSE))
+        blinkJob_st s_blinkJob = {0};
+        uint32_t foundMask_u32 = 0;
+
+        // parse job document straight into the typed fields, count is mandatory
+        if (JSON_bind(gJobDocumentStr, NULL, blinkJobBindings, BLINK_JOB_BINDINGS, &s_blinkJob, &foundMask_u32) &&
+            util_IsBitSet(foundMask_u32, BLINK_JOB_COUNT))
         {
-            countValue_u32 = util_getNumFromStringU32(countStr);
-            onTime_u32 = util_getNumFromStringU32(onTimeStr);
-            offTime_u32 = util_getNumFromStringU32(offTimeStr);
+            uint32_t countValue_u32 = s_blinkJob.count_u32;
+            uint32_t onTime_u32 = s_blinkJob.onTime_u32;
+            uint32_t offTime_u32 = s_blinkJob.offTime_u32;
 
             printf("\r\nblink %ld times => ON:%ldms OFF:%ldms", countValue_u32, onTime_u32, offTime_u32);
             if (countValue_u32 < MAX_LED_BLINK_COUNT)
@@ -130,6 +145,7 @@ void app_jobCheck()
         else
         {
             print_error("Error: Invalid job document: %s", gJobDocumentStr);
+            JOBS_updateStatus(gJobIdStr, JOB_STATUS_FAILED);
         }
     }
 }
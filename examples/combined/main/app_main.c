@@ -18,7 +18,9 @@
 #include "lib_ble.h"
 #include "lib_system.h"
 #include "lib_jobs.h"
+#include "lib_jsonReader.h"
 #include "lib_gpio.h"
+#include "lib_wifi.h"
 #include "app_config.h"
 
 /* Macros ------------------------------------------------------------------*/
@@ -45,6 +47,39 @@ static char gJobIdStr[LENGTH_JOB_ID] = {0};
 static char gJobDocumentStr[LENGTH_JOB_DOCUMENT] = {0};
 static bool gJobReceived_b8 = FALSE;
 
+/* Blink job document {"count":3, "onTime":250, "offTime":500} */
+typedef struct
+{
+    uint32_t count_u32;
+    uint32_t onTime_u32;
+    uint32_t offTime_u32;
+} blinkJob_st;
+
+/* Binding index, also the bit in the found mask */
+typedef enum
+{
+    BLINK_JOB_COUNT,
+    BLINK_JOB_ON_TIME,
+    BLINK_JOB_OFF_TIME,
+    BLINK_JOB_BINDINGS
+} blinkJobBind_et;
+
+static const jsonBinding_st blinkJobBindings[BLINK_JOB_BINDINGS] = {
+    [BLINK_JOB_COUNT] = JSON_BIND(blinkJob_st, "count", JSON_BIND_TYPE_U32, count_u32),
+    [BLINK_JOB_ON_TIME] = JSON_BIND(blinkJob_st, "onTime", JSON_BIND_TYPE_U32, onTime_u32),
+    [BLINK_JOB_OFF_TIME] = JSON_BIND(blinkJob_st, "offTime", JSON_BIND_TYPE_U32, offTime_u32),
+};
+
+/* Connect-time breakdown, timestamps in micro seconds */
+typedef struct
+{
+    int64_t start_i64;         /*!< SYSTEM_start() called or link lost */
+    int64_t wifiConnected_i64; /*!< EVENT_WIFI_CONNECTED received */
+    int64_t mqttConnected_i64; /*!< EVENT_MQTT_CONNECTED received */
+} connectTime_st;
+
+static connectTime_st gConnectTime_st = {0};
+
 void classicShadowUpdateCallBack(uint8_t elementIndex_u8, const char *pKeyStr, const void *pValue);
 
 #define CLASSIC_SHADOW 0
@@ -89,22 +124,41 @@ void classicShadowUpdateCallBack(uint8_t elementIndex_u8, const char *pKeyStr, c
     }
 }
 
+void app_printConnectTime()
+{
+    int64_t wifiTime_i64 = gConnectTime_st.wifiConnected_i64 - gConnectTime_st.start_i64;
+    int64_t mqttTime_i64 = gConnectTime_st.mqttConnected_i64 - gConnectTime_st.wifiConnected_i64;
+
+    printf("\nConnect time => WIFI:%lldms MQTT:%lldms TOTAL:%lldms",
+           wifiTime_i64 / 1000, mqttTime_i64 / 1000, (wifiTime_i64 + mqttTime_i64) / 1000);
+}
+
 void app_eventsCallBackHandler(systemEvents_et event_e)
 {
     switch (event_e)
     {
     case EVENT_WIFI_CONNECTED:
         printf("\nEVENT_WIFI_CONNECTED");
+        gConnectTime_st.wifiConnected_i64 = micros();
         break;
     case EVENT_WIFI_DISCONNECTED:
         printf("\nEVENT_WIFI_DISCONNECTED");
+        gConnectTime_st.start_i64 = micros(); // measure the reconnect from here
         break;
 
     case EVENT_MQTT_CONNECTED:
         printf("\nEVENT_MQTT_CONNECTED");
+        gConnectTime_st.mqttConnected_i64 = micros();
+        app_printConnectTime();
         break;
     case EVENT_MQTT_DISCONNECTED:
         printf("\nEVENT_MQTT_DISCONNECTED");
+        if (WIFI_isConnected())
+        {
+            // wifi is still up, only the MQTT leg is measured on reconnect
+            gConnectTime_st.start_i64 = micros();
+            gConnectTime_st.wifiConnected_i64 = gConnectTime_st.start_i64;
+        }
         break;
 
     case EVENT_BLE_CONNECTED:
@@ -143,25 +197,16 @@ void app_jobCheck()
     {
         gJobReceived_b8 = FALSE;
 
-        uint32_t countValue_u32 = 0;
-        uint32_t onTime_u32 = 0;
-        uint32_t offTime_u32 = 0;
-        char countStr[4] = {0};
-        char onTimeStr[4] = {0};
-        char offTimeStr[4] = {0};
-
-        // variable for extracting json key-value pair
-        tagStructure_st jobKeyValuePair[3] = {
-            {"count", countStr},
-            {"onTime", onTimeStr},
-            {"offTime", offTimeStr}};
-
-        // parse job document to initialize count value
-        if (JSON_processString(gJobDocumentStr, jobKeyValuePair, 3, FALSE))
+        blinkJob_st s_blinkJob = {0};
+        uint32_t foundMask_u32 = 0;
+
+        // parse job document straight into the typed fields, count is mandatory
+        if (JSON_bind(gJobDocumentStr, NULL, blinkJobBindings, BLINK_JOB_BINDINGS, &s_blinkJob, &foundMask_u32) &&
+            util_IsBitSet(foundMask_u32, BLINK_JOB_COUNT))
         {
-            countValue_u32 = util_getNumFromStringU32(countStr);
-            onTime_u32 = util_getNumFromStringU32(onTimeStr);
-            offTime_u32 = util_getNumFromStringU32(offTimeStr);
+            uint32_t countValue_u32 = s_blinkJob.count_u32;
+            uint32_t onTime_u32 = s_blinkJob.onTime_u32;
+            uint32_t offTime_u32 = s_blinkJob.offTime_u32;
 
             printf("\nblink %ld times => ON:%ldms OFF:%ldms", countValue_u32, onTime_u32, offTime_u32);
             if (countValue_u32 < MAX_LED_BLINK_COUNT)
@@ -192,6 +237,7 @@ void app_jobCheck()
         else
         {
             print_error("Error: Invalid job document: %s", gJobDocumentStr);
+            JOBS_updateStatus(gJobIdStr, JOB_STATUS_FAILED);
         }
     }
 }
@@ -298,6 +344,7 @@ void app_main()
             }
         }
 
+        gConnectTime_st.start_i64 = micros();
         SYSTEM_start();
 
         BaseType_t err = xTaskCreate(&app_task, "app_task", TASK_APP_STACK_SIZE, NULL, TASK_APP_PRIORITY, NULL);